@@ -0,0 +1,197 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AccessorDataStore.h>
+#include <GLTFSDK/IRandomAccessReader.h>
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // Serves a single in-memory buffer and counts the reads made from it
+    class CountingRandomAccessReader : public IRandomAccessReader
+    {
+    public:
+        CountingRandomAccessReader(std::vector<float> values) : m_values(std::move(values)), m_readCount(0U)
+        {
+        }
+
+        void ReadAt(const std::string&, size_t offset, size_t byteCount, void* data) const override
+        {
+            std::memcpy(data, reinterpret_cast<const uint8_t*>(m_values.data()) + offset, byteCount);
+            ++m_readCount;
+        }
+
+        size_t Size(const std::string&) const override
+        {
+            return m_values.size() * sizeof(float);
+        }
+
+        size_t GetReadCount() const
+        {
+            return m_readCount;
+        }
+
+    private:
+        std::vector<float> m_values;
+        mutable std::atomic<size_t> m_readCount;
+    };
+
+    // Creates a document with one buffer view of values.size() floats and an accessor for each of its VEC3s
+    Document CreateVec3Document(const std::vector<float>& values)
+    {
+        Document document;
+
+        Buffer buffer;
+        buffer.id = "0";
+        buffer.uri = "buffer.bin";
+        buffer.byteLength = values.size() * sizeof(float);
+        document.buffers.Append(std::move(buffer));
+
+        BufferView bufferView;
+        bufferView.id = "0";
+        bufferView.bufferId = "0";
+        bufferView.byteLength = values.size() * sizeof(float);
+        document.bufferViews.Append(std::move(bufferView));
+
+        for (size_t i = 0U; i < values.size() / 3U; ++i)
+        {
+            Accessor accessor;
+            accessor.id = std::to_string(i);
+            accessor.bufferViewId = "0";
+            accessor.byteOffset = i * 3U * sizeof(float);
+            accessor.componentType = COMPONENT_FLOAT;
+            accessor.type = TYPE_VEC3;
+            accessor.count = 1U;
+            document.accessors.Append(std::move(accessor));
+        }
+
+        return document;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(AccessorDataStoreTests)
+            {
+                GLTFSDK_TEST_METHOD(AccessorDataStoreTests, AccessorDataStoreGet)
+                {
+                    const std::vector<float> values = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+
+                    const Document document = CreateVec3Document(values);
+
+                    auto randomAccessReader = std::make_shared<CountingRandomAccessReader>(values);
+                    GLTFResourceReader reader(randomAccessReader);
+
+                    AccessorDataStore store(document, reader, 24U);// Room for two VEC3 accessors
+
+                    // The accessor is only read on first access
+                    auto data1 = store.Get("0");
+                    Assert::IsTrue(data1.ToVector<float>() == std::vector<float>{ 0.0f, 1.0f, 2.0f });
+                    Assert::IsTrue(store.Get("0").Data() == data1.Data());
+                    Assert::AreEqual<size_t>(1U, randomAccessReader->GetReadCount());
+
+                    Assert::IsTrue(store.GetVector<float>("1") == std::vector<float>{ 3.0f, 4.0f, 5.0f });
+                    Assert::AreEqual<size_t>(24U, store.GetByteCount());
+
+                    // Accessing "0" makes "1" the least recently used accessor, so storing "2" evicts it
+                    store.Get(document.accessors.Get("0"));
+                    store.Get("2");
+
+                    Assert::AreEqual<size_t>(2U, store.Size());
+                    Assert::IsTrue(store.Contains("0"));
+                    Assert::IsFalse(store.Contains("1"));
+                    Assert::IsTrue(data1.ToVector<float>() == std::vector<float>{ 0.0f, 1.0f, 2.0f });// Evicted data remains valid
+
+                    const auto stats = store.GetStats();
+
+                    Assert::AreEqual<size_t>(2U, stats.hitCount);
+                    Assert::AreEqual<size_t>(3U, stats.missCount);
+                    Assert::AreEqual<size_t>(1U, stats.evictionCount);
+
+                    // Reducing the budget evicts the least recently used accessor
+                    store.SetByteBudget(12U);
+
+                    Assert::AreEqual<size_t>(1U, store.Size());
+                    Assert::IsTrue(store.Contains("2"));
+
+                    // Failed reads aren't stored and don't prevent later attempts
+                    Assert::ExpectException<GLTFException>([&store]()
+                    {
+                        store.Get("3");
+                    });
+
+                    Assert::ExpectException<GLTFException>([&store]()
+                    {
+                        store.Get("3");
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorDataStoreTests, AccessorDataStorePrefetchConcurrent)
+                {
+                    std::vector<float> values(3U * 64U);
+
+                    for (size_t i = 0U; i < values.size(); ++i)
+                    {
+                        values[i] = static_cast<float>(i);
+                    }
+
+                    const Document document = CreateVec3Document(values);
+
+                    auto randomAccessReader = std::make_shared<CountingRandomAccessReader>(values);
+                    GLTFResourceReader reader(randomAccessReader);
+
+                    AccessorDataStore store(document, reader);
+
+                    // Adjacent accessors are coalesced into a single read
+                    store.Prefetch({ "0", "1", "2", "3", "1" }, 1U);
+
+                    Assert::AreEqual<size_t>(4U, store.Size());
+                    Assert::AreEqual<size_t>(1U, randomAccessReader->GetReadCount());
+
+                    // Every accessor is read once however many threads request it
+                    std::vector<std::thread> threads;
+                    std::atomic<bool> isValid(true);
+
+                    for (size_t t = 0U; t < 4U; ++t)
+                    {
+                        threads.emplace_back([&]()
+                        {
+                            for (size_t i = 0U; i < values.size() / 3U; ++i)
+                            {
+                                const auto data = store.GetVector<float>(std::to_string(i));
+
+                                if (data != std::vector<float>(values.begin() + i * 3U, values.begin() + i * 3U + 3U))
+                                {
+                                    isValid = false;
+                                }
+                            }
+                        });
+                    }
+
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    Assert::IsTrue(isValid);
+                    Assert::AreEqual<size_t>(64U, store.Size());
+                    Assert::AreEqual<size_t>(61U, randomAccessReader->GetReadCount());
+                    Assert::AreEqual<size_t>(64U, store.GetStats().missCount);
+                }
+            };
+        }
+    }
+}
@@ -4,8 +4,16 @@
 #include "stdafx.h"
 
 #include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+#include <GLTFSDK/SchemaValidation.h>
+#include <GLTFSDK/ThreadPoolExecutor.h>
 #include <GLTFSDK/Validation.h>
 
+#include "TestResources.h"
+#include "TestUtils.h"
+
+#include <sstream>
+
 using namespace glTF::UnitTest;
 
 namespace
@@ -540,6 +548,130 @@ namespace Microsoft
                     Assert::AreEqual(doc.samplers[1].wrapS, Wrap_MIRRORED_REPEAT, L"Sampler wrapS property was not deserialized correctly");
                     Assert::AreEqual(doc.samplers[1].wrapT, Wrap_CLAMP_TO_EDGE, L"Sampler wrapT property was not deserialized correctly");
                 }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_Streaming)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+
+                    for (auto path : { c_cubeJson, c_dracoBox, c_animatedTriangleJson, c_validMorphTarget, c_cubeWithLODJson })
+                    {
+                        const auto json = ReadLocalJson(path);
+
+                        const auto doc = Deserialize(json, extensionDeserializer);
+
+                        Assert::IsTrue(doc == Deserialize(json, extensionDeserializer, DeserializeFlags::Streaming), L"Streaming deserialize of a string produced a different document");
+
+                        std::stringstream jsonStream(json);
+
+                        Assert::IsTrue(doc == Deserialize(jsonStream, extensionDeserializer, DeserializeFlags::Streaming), L"Streaming deserialize of a stream produced a different document");
+                    }
+
+                    Assert::IsTrue(Deserialize(c_validSamplerDocument) == Deserialize(c_validSamplerDocument, DeserializeFlags::Streaming));
+
+                    // Validating while parsing reads the JSON once
+                    const auto json = ReadLocalJson(c_cubeJson);
+
+                    std::stringstream jsonStream(json);
+
+                    Assert::IsTrue(Deserialize(json, extensionDeserializer) == Deserialize(jsonStream, extensionDeserializer, DeserializeFlags::Streaming | DeserializeFlags::ValidateWhileParsing));
+                    Assert::IsTrue(Deserialize(c_extraFieldsJson) == Deserialize(c_extraFieldsJson, DeserializeFlags::Streaming));
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_ValidateWhileParsing)
+                {
+                    for (auto path : { c_cubeJson, c_animatedTriangleJson, c_validMorphTarget })
+                    {
+                        const auto json = ReadLocalJson(path);
+
+                        std::stringstream jsonStream(json);
+
+                        Assert::IsTrue(Deserialize(json) == Deserialize(jsonStream, DeserializeFlags::ValidateWhileParsing));
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeFail_ValidateWhileParsingNegativeAccessorOffset)
+                {
+                    Assert::ExpectException<ValidationException>([]()
+                    {
+                        try
+                        {
+                            Deserialize(c_negativeAccessorOffset, DeserializeFlags::ValidateWhileParsing);
+                        }
+                        catch (const ValidationException& ex)
+                        {
+                            Assert::AreEqual("Schema violation at #/accessors/0/byteOffset due to minimum", ex.what());
+                            throw;
+                        }
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeFail_StreamingNegativeAccessorCount)
+                {
+                    Assert::ExpectException<ValidationException>([]()
+                    {
+                        try
+                        {
+                            Deserialize(c_negativeAccessorCount, DeserializeFlags::Streaming);
+                        }
+                        catch (const ValidationException& ex)
+                        {
+                            Assert::AreEqual("Schema violation at #/accessors/0/count due to minimum", ex.what());
+                            throw;
+                        }
+                    });
+
+                    Assert::ExpectException<ValidationException>([]()
+                    {
+                        try
+                        {
+                            Deserialize(c_negativeAccessorCount, DeserializeFlags::Streaming | DeserializeFlags::ValidateWhileParsing);
+                        }
+                        catch (const ValidationException& ex)
+                        {
+                            Assert::AreEqual("Schema violation at #/accessors/0/count due to minimum", ex.what());
+                            throw;
+                        }
+                    });
+
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        Deserialize("{ \"asset\": { \"version\": \"2.0\" }, \"nodes\": [ {} ", DeserializeFlags::Streaming);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_Parallel)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+                    const auto schema = SchemaCache::GetProcessCache()->Get(SchemaFlags::None);
+
+                    ThreadPoolExecutor executor(4U);
+
+                    for (auto path : { c_cubeJson, c_dracoBox, c_animatedTriangleJson, c_validMorphTarget, c_cubeWithLODJson })
+                    {
+                        const auto json = ReadLocalJson(path);
+
+                        std::stringstream jsonStream(json);
+
+                        Assert::IsTrue(Deserialize(json, extensionDeserializer) == Deserialize(jsonStream, extensionDeserializer, *schema, executor), L"Parallel deserialize produced a different document");
+                    }
+
+                    // Enough nodes that they're split across several tasks
+                    std::stringstream nodesJson;
+
+                    nodesJson << R"({ "asset": { "version": "2.0" }, "nodes": [)";
+
+                    for (size_t i = 0U; i < 1000U; ++i)
+                    {
+                        nodesJson << (i ? "," : "") << R"({ "name": "Node)" << i << R"(", "translation": [ )" << i << ", 0, 0 ] }";
+                    }
+
+                    nodesJson << "] }";
+
+                    const auto doc = Deserialize(nodesJson.str(), extensionDeserializer, *schema, executor, DeserializeFlags::ValidateWhileParsing);
+
+                    Assert::AreEqual<size_t>(1000U, doc.nodes.Size());
+                    Assert::IsTrue(doc == Deserialize(nodesJson.str()));
+                }
             };
         }
     }
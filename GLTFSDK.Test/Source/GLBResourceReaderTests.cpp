@@ -0,0 +1,263 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Constants.h>
+#include <GLTFSDK/FileRandomAccessReader.h>
+#include <GLTFSDK/GLBResourceReader.h>
+#include <GLTFSDK/GLBResourceWriter.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include "TestUtils.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    const char c_manifest[] = R"({"asset":{"version":"2.0"}})";
+
+    const std::vector<float> c_positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+    const std::vector<uint16_t> c_indices = { 0U, 1U, 2U };
+
+    // Writes a GLB containing index and position accessors and returns its bytes along with the matching Document
+    std::shared_ptr<const std::vector<uint8_t>> CreateGLB(Document& document)
+    {
+        auto streamWriter = std::make_shared<Test::StreamReaderWriter>();
+        auto resourceWriter = std::make_unique<GLBResourceWriter>(streamWriter);
+        auto resourceWriterPtr = resourceWriter.get();
+
+        BufferBuilder bufferBuilder(std::move(resourceWriter));
+
+        bufferBuilder.AddBuffer(GLB_BUFFER_ID);
+        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+        bufferBuilder.AddAccessor(c_indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT });
+        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+        bufferBuilder.AddAccessor(c_positions, { TYPE_VEC3, COMPONENT_FLOAT });
+        bufferBuilder.Output(document);
+
+        resourceWriterPtr->Flush(c_manifest, "test.glb");
+
+        auto stream = streamWriter->GetInputStream("test.glb");
+        return std::make_shared<const std::vector<uint8_t>>(StreamUtils::ReadBinaryFull<uint8_t>(*stream));
+    }
+
+    void CheckAccessors(const GLBResourceReader& reader, const Document& document, const uint8_t* binaryData)
+    {
+        const auto& indicesAccessor = document.accessors.Get("0");
+        const auto& positionsAccessor = document.accessors.Get("1");
+
+        Assert::IsTrue(reader.ReadBinaryData<uint16_t>(document, indicesAccessor) == c_indices);
+        Assert::IsTrue(reader.ReadBinaryData<float>(document, positionsAccessor) == c_positions);
+
+        // Accessor views should reference the BIN chunk data directly
+        auto view = reader.ReadBinaryDataView<float>(document, positionsAccessor);
+        const auto& bufferView = document.bufferViews.Get(positionsAccessor.bufferViewId);
+
+        Assert::IsTrue(reinterpret_cast<const uint8_t*>(view.Data()) == binaryData + bufferView.byteOffset + positionsAccessor.byteOffset);
+        Assert::IsTrue(view.ToVector() == c_positions);
+    }
+
+    size_t GetBinaryChunkOffset(const std::vector<uint8_t>& glbData)
+    {
+        uint32_t jsonChunkLength;
+        std::memcpy(&jsonChunkLength, glbData.data() + GLB2_HEADER_BYTE_SIZE, sizeof(jsonChunkLength));
+        return GLB_HEADER_BYTE_SIZE + jsonChunkLength + sizeof(uint32_t) + GLB_CHUNK_TYPE_SIZE;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(GLBResourceReaderTests)
+            {
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBResourceReader_MemoryStream)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    GLBResourceReader reader(std::make_shared<StreamReaderWriter>(), std::make_shared<MemoryStream>(glbData));
+
+                    Assert::AreEqual(std::string(c_manifest), reader.GetJson().substr(0, sizeof(c_manifest) - 1));
+
+                    CheckAccessors(reader, document, glbData->data() + GetBinaryChunkOffset(*glbData));
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBResourceReader_MemoryStream_MatchesStream)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    auto stream = std::make_shared<std::stringstream>();
+                    stream->write(reinterpret_cast<const char*>(glbData->data()), glbData->size());
+
+                    GLBResourceReader streamReader(std::make_shared<StreamReaderWriter>(), stream);
+                    GLBResourceReader memoryReader(std::make_shared<StreamReaderWriter>(), std::make_shared<MemoryStream>(glbData));
+
+                    Assert::AreEqual(streamReader.GetJson(), memoryReader.GetJson());
+
+                    const auto& accessor = document.accessors.Get("1");
+                    Assert::IsTrue(streamReader.ReadBinaryData<float>(document, accessor) == memoryReader.ReadBinaryData<float>(document, accessor));
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBResourceReader_MemoryStream_Truncated)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    // Drop the last 4 bytes of the BIN chunk so the reported length no longer matches
+                    auto truncatedData = std::make_shared<const std::vector<uint8_t>>(glbData->begin(), glbData->end() - 4);
+
+                    Assert::ExpectException<InvalidGLTFException>([&truncatedData]()
+                    {
+                        GLBResourceReader reader(std::make_shared<StreamReaderWriter>(), std::make_shared<MemoryStream>(truncatedData));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBMappedResourceReader_File)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    const std::string path = "GLBMappedResourceReaderTest.glb";
+
+                    {
+                        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                        file.write(reinterpret_cast<const char*>(glbData->data()), glbData->size());
+                    }
+
+                    {
+                        GLBMappedResourceReader reader(std::make_shared<StreamReaderWriter>(), path);
+
+                        Assert::AreEqual(std::string(c_manifest), reader.GetJson().substr(0, sizeof(c_manifest) - 1));
+
+                        const auto& accessor = document.accessors.Get("1");
+                        Assert::IsTrue(reader.ReadBinaryData<float>(document, accessor) == c_positions);
+                    }
+
+                    std::remove(path.c_str());
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBResourceReader_RandomAccess)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    const std::string path = "GLBRandomAccessResourceReaderTest.glb";
+
+                    {
+                        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                        file.write(reinterpret_cast<const char*>(glbData->data()), glbData->size());
+                    }
+
+                    {
+                        GLBResourceReader reader(std::make_shared<FileRandomAccessReader>(), path);
+
+                        Assert::AreEqual(std::string(c_manifest), reader.GetJson().substr(0, sizeof(c_manifest) - 1));
+
+                        Assert::IsTrue(reader.ReadBinaryData<uint16_t>(document, document.accessors.Get("0")) == c_indices);
+                        Assert::IsTrue(reader.ReadBinaryData<float>(document, document.accessors.Get("1")) == c_positions);
+
+                        Assert::ExpectException<GLTFException>([&]()
+                        {
+                            reader.GetBinaryStream(document.buffers.Get(GLB_BUFFER_ID));
+                        });
+                    }
+
+                    std::remove(path.c_str());
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBResourceReader_RandomAccess_StreamAdapter)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    auto streamReader = std::make_shared<StreamReaderWriter>();
+                    streamReader->GetOutputStream("test.glb")->write(reinterpret_cast<const char*>(glbData->data()), glbData->size());
+
+                    GLBResourceReader streamResourceReader(streamReader, streamReader->GetInputStream("test.glb"));
+                    GLBResourceReader randomAccessResourceReader(std::make_shared<StreamRandomAccessReader>(streamReader), "test.glb");
+
+                    Assert::AreEqual(streamResourceReader.GetJson(), randomAccessResourceReader.GetJson());
+
+                    const auto& accessor = document.accessors.Get("1");
+                    Assert::IsTrue(randomAccessResourceReader.ReadBinaryData<float>(document, accessor) == streamResourceReader.ReadBinaryData<float>(document, accessor));
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBHeader_Probe)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    auto streamReader = std::make_shared<StreamReaderWriter>();
+                    streamReader->GetOutputStream("test.glb")->write(reinterpret_cast<const char*>(glbData->data()), glbData->size());
+
+                    const GLBHeader header = ReadGLBHeader(glbData->data(), glbData->size());
+
+                    Assert::AreEqual<uint32_t>(GLB_HEADER_VERSION_2, header.version);
+                    Assert::AreEqual(glbData->size(), header.byteLength);
+                    Assert::AreEqual<size_t>(GLB_HEADER_BYTE_SIZE, header.jsonChunkOffset);
+                    Assert::IsTrue(header.HasBinChunk());
+                    Assert::AreEqual(GetBinaryChunkOffset(*glbData), header.binChunkOffset);
+                    Assert::AreEqual(glbData->size(), header.binChunkOffset + header.binChunkLength);
+
+                    // Streams and random access readers give the same layout
+                    const GLBHeader streamHeader = ReadGLBHeader(*streamReader->GetInputStream("test.glb"));
+                    const GLBHeader randomAccessHeader = ReadGLBHeader(StreamRandomAccessReader(streamReader), "test.glb");
+
+                    Assert::AreEqual(header.jsonChunkLength, streamHeader.jsonChunkLength);
+                    Assert::AreEqual(header.binChunkOffset, streamHeader.binChunkOffset);
+                    Assert::AreEqual(header.jsonChunkLength, randomAccessHeader.jsonChunkLength);
+                    Assert::AreEqual(header.binChunkOffset, randomAccessHeader.binChunkOffset);
+
+                    Assert::ExpectException<InvalidGLTFException>([&glbData]()
+                    {
+                        ReadGLBHeader(glbData->data(), glbData->size() - 4U);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBHeader_JsonStream)
+                {
+                    Document document;
+                    auto glbData = CreateGLB(document);
+
+                    auto stream = std::make_shared<std::stringstream>();
+                    stream->write(reinterpret_cast<const char*>(glbData->data()), glbData->size());
+
+                    const std::string json = GLBResourceReader(std::make_shared<StreamReaderWriter>(), stream).GetJson();
+
+                    auto memoryStream = std::make_shared<MemoryStream>(glbData);
+
+                    for (const std::shared_ptr<std::istream>& glbStream : { std::shared_ptr<std::istream>(stream), std::shared_ptr<std::istream>(memoryStream) })
+                    {
+                        auto jsonStream = GetGLBJsonStream(glbStream, ReadGLBHeader(*glbStream));
+
+                        Assert::AreEqual(json, std::string(std::istreambuf_iterator<char>(*jsonStream), std::istreambuf_iterator<char>()));
+                    }
+
+                    // A MemoryStream's JSON chunk is referenced rather than copied
+                    auto jsonStream = std::dynamic_pointer_cast<MemoryStream>(GetGLBJsonStream(memoryStream, ReadGLBHeader(glbData->data(), glbData->size())));
+
+                    Assert::IsTrue(jsonStream && jsonStream->GetData().get() == glbData->data() + GLB_HEADER_BYTE_SIZE);
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceReaderTests, GLBMappedResourceReader_MissingFile)
+                {
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        GLBMappedResourceReader reader(std::make_shared<StreamReaderWriter>(), "DoesNotExist.glb");
+                    });
+                }
+            };
+        }
+    }
+}
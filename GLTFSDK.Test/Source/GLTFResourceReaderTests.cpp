@@ -3,11 +3,19 @@
 
 #include "stdafx.h"
 
+#include <GLTFSDK/Constants.h>
 #include <GLTFSDK/Deserialize.h>
 #include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MemoryStream.h>
+#include <GLTFSDK/StreamCacheThreadLocal.h>
+#include <GLTFSDK/ThreadPoolExecutor.h>
 
 #include "TestUtils.h"
 
+#include <atomic>
+#include <numeric>
+#include <thread>
+
 using namespace glTF::UnitTest;
 
 namespace
@@ -387,6 +395,158 @@ namespace
     ]
 }
 )";
+
+    class MemoryStreamReader : public Microsoft::glTF::IStreamReader
+    {
+    public:
+        void Add(const std::string& uri, std::shared_ptr<const std::vector<uint8_t>> data)
+        {
+            m_data[uri] = std::move(data);
+        }
+
+        std::shared_ptr<std::istream> GetInputStream(const std::string& uri) const override
+        {
+            return std::make_shared<Microsoft::glTF::MemoryStream>(m_data.at(uri));
+        }
+
+    private:
+        std::unordered_map<std::string, std::shared_ptr<const std::vector<uint8_t>>> m_data;
+    };
+
+    // Returns a new stream over a copy of the data on every call, so that each caller has its own read position
+    class StringStreamReader : public Microsoft::glTF::IStreamReader
+    {
+    public:
+        void Add(const std::string& uri, std::string data)
+        {
+            m_data[uri] = std::move(data);
+        }
+
+        std::shared_ptr<std::istream> GetInputStream(const std::string& uri) const override
+        {
+            return std::make_shared<std::stringstream>(m_data.at(uri));
+        }
+
+    private:
+        std::unordered_map<std::string, std::string> m_data;
+    };
+
+    // Records the byte ranges of the reads made through it
+    class RecordingRandomAccessReader : public Microsoft::glTF::IRandomAccessReader
+    {
+    public:
+        explicit RecordingRandomAccessReader(std::shared_ptr<const Microsoft::glTF::IRandomAccessReader> reader) : m_reader(std::move(reader))
+        {
+        }
+
+        void ReadAt(const std::string& uri, size_t offset, size_t byteCount, void* data) const override
+        {
+            m_reads.push_back({ offset, offset + byteCount });
+            m_reader->ReadAt(uri, offset, byteCount, data);
+        }
+
+        size_t Size(const std::string& uri) const override
+        {
+            return m_reader->Size(uri);
+        }
+
+        mutable std::vector<Microsoft::glTF::ByteRange> m_reads;
+
+    private:
+        std::shared_ptr<const Microsoft::glTF::IRandomAccessReader> m_reader;
+    };
+
+    template<typename T>
+    std::shared_ptr<const std::vector<uint8_t>> MakeBufferData(const std::vector<T>& values)
+    {
+        auto begin = reinterpret_cast<const uint8_t*>(values.data());
+        return std::make_shared<const std::vector<uint8_t>>(begin, begin + values.size() * sizeof(T));
+    }
+
+    // A single buffer and buffer view with the specified stride, and one accessor into the buffer view
+    Microsoft::glTF::Document CreateAccessorDocument(const std::string& uri, size_t byteLength, Microsoft::glTF::AccessorType type, Microsoft::glTF::ComponentType componentType,
+        size_t count, size_t byteOffset = 0U, size_t byteStride = 0U)
+    {
+        using namespace Microsoft::glTF;
+
+        Document document;
+
+        Buffer buffer;
+        buffer.id = "0";
+        buffer.uri = uri;
+        buffer.byteLength = byteLength;
+        document.buffers.Append(std::move(buffer));
+
+        BufferView bufferView;
+        bufferView.id = "0";
+        bufferView.bufferId = "0";
+        bufferView.byteLength = byteLength;
+        if (byteStride)
+        {
+            bufferView.byteStride = byteStride;
+        }
+        document.bufferViews.Append(std::move(bufferView));
+
+        Accessor accessor;
+        accessor.id = "0";
+        accessor.bufferViewId = "0";
+        accessor.byteOffset = byteOffset;
+        accessor.componentType = componentType;
+        accessor.count = count;
+        accessor.type = type;
+        document.accessors.Append(std::move(accessor));
+
+        return document;
+    }
+
+    Microsoft::glTF::Document CreateFloatAccessorDocument(size_t byteLength, size_t count, Microsoft::glTF::AccessorType type, size_t byteOffset = 0U, size_t byteStride = 0U)
+    {
+        return CreateAccessorDocument("buffer.bin", byteLength, type, Microsoft::glTF::COMPONENT_FLOAT, count, byteOffset, byteStride);
+    }
+
+    // A float VEC3 sparse accessor with no base buffer view. The buffer holds sparseCount uint16 indices (padded to a
+    // multiple of 4 bytes) followed by the sparseCount VEC3 values.
+    Microsoft::glTF::Document CreateSparseAccessorDocument(const std::string& uri, size_t count, size_t sparseCount)
+    {
+        using namespace Microsoft::glTF;
+
+        const size_t indicesByteLength = (sparseCount * sizeof(uint16_t) + 3U) & ~size_t(3U);
+        const size_t valuesByteLength = sparseCount * 3U * sizeof(float);
+
+        Document document;
+
+        Buffer buffer;
+        buffer.id = "0";
+        buffer.uri = uri;
+        buffer.byteLength = indicesByteLength + valuesByteLength;
+        document.buffers.Append(std::move(buffer));
+
+        BufferView indicesBufferView;
+        indicesBufferView.id = "0";
+        indicesBufferView.bufferId = "0";
+        indicesBufferView.byteLength = indicesByteLength;
+        document.bufferViews.Append(std::move(indicesBufferView));
+
+        BufferView valuesBufferView;
+        valuesBufferView.id = "1";
+        valuesBufferView.bufferId = "0";
+        valuesBufferView.byteOffset = indicesByteLength;
+        valuesBufferView.byteLength = valuesByteLength;
+        document.bufferViews.Append(std::move(valuesBufferView));
+
+        Accessor accessor;
+        accessor.id = "0";
+        accessor.componentType = COMPONENT_FLOAT;
+        accessor.count = count;
+        accessor.type = TYPE_VEC3;
+        accessor.sparse.count = sparseCount;
+        accessor.sparse.indicesBufferViewId = "0";
+        accessor.sparse.indicesComponentType = COMPONENT_UNSIGNED_SHORT;
+        accessor.sparse.valuesBufferViewId = "1";
+        document.accessors.Append(std::move(accessor));
+
+        return document;
+    }
 }
 
 namespace Microsoft
@@ -432,6 +592,96 @@ namespace Microsoft
                     Assert::IsTrue(img2 == std::vector<uint8_t>{105, 183, 29, 106, 12, 161, 185, 183});
                 }
 
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadImageChunked)
+                {
+                    std::vector<uint8_t> bufferData(20U);
+                    std::vector<uint8_t> imageData(10U);
+                    std::vector<uint8_t> base64ImageData = { 181U, 183U, 29U, 105U, 12U, 161U, 185U, 183U };
+
+                    std::iota(bufferData.begin(), bufferData.end(), uint8_t(0U));
+                    std::iota(imageData.begin(), imageData.end(), uint8_t(100U));
+
+                    Document gltfDoc;
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.uri = "buffer.bin";
+                    buffer.byteLength = bufferData.size();
+                    gltfDoc.buffers.Append(std::move(buffer));
+
+                    BufferView bufferView;
+                    bufferView.id = "0";
+                    bufferView.bufferId = "0";
+                    bufferView.byteOffset = 4U;
+                    bufferView.byteLength = 13U;
+                    gltfDoc.bufferViews.Append(std::move(bufferView));
+
+                    Image bufferViewImage;
+                    bufferViewImage.id = "0";
+                    bufferViewImage.bufferViewId = "0";
+                    gltfDoc.images.Append(std::move(bufferViewImage));
+
+                    Image uriImage;
+                    uriImage.id = "1";
+                    uriImage.uri = "image.png";
+                    gltfDoc.images.Append(std::move(uriImage));
+
+                    Image base64Image;
+                    base64Image.id = "2";
+                    base64Image.uri = "data:image/png;base64," + Base64Encode(base64ImageData);
+                    gltfDoc.images.Append(std::move(base64Image));
+
+                    const std::vector<std::vector<uint8_t>> expected = {
+                        std::vector<uint8_t>(bufferData.begin() + 4, bufferData.begin() + 17),
+                        imageData,
+                        base64ImageData };
+
+                    auto memoryStreamReader = std::make_shared<MemoryStreamReader>();
+                    memoryStreamReader->Add("buffer.bin", MakeBufferData(bufferData));
+                    memoryStreamReader->Add("image.png", MakeBufferData(imageData));
+
+                    auto stringStreamReader = std::make_shared<StringStreamReader>();
+                    stringStreamReader->Add("buffer.bin", std::string(bufferData.begin(), bufferData.end()));
+                    stringStreamReader->Add("image.png", std::string(imageData.begin(), imageData.end()));
+
+                    GLTFResourceReader memoryReader(memoryStreamReader);
+                    GLTFResourceReader streamReader(stringStreamReader);
+                    GLTFResourceReader randomAccessReader(std::make_shared<StreamRandomAccessReader>(stringStreamReader));
+
+                    // Resident images are returned without a copy, images that have to be read or decoded aren't
+                    size_t byteLength = 0U;
+
+                    auto view = memoryReader.ReadBinaryDataView(gltfDoc, gltfDoc.images.Get("0"), byteLength);
+                    Assert::IsTrue(view != nullptr);
+                    Assert::AreEqual<size_t>(13U, byteLength);
+                    Assert::IsTrue(std::vector<uint8_t>(view.get(), view.get() + byteLength) == expected[0]);
+
+                    Assert::IsTrue(memoryReader.ReadBinaryDataView(gltfDoc, gltfDoc.images.Get("1"), byteLength) != nullptr);
+                    Assert::IsTrue(memoryReader.ReadBinaryDataView(gltfDoc, gltfDoc.images.Get("2"), byteLength) == nullptr);
+                    Assert::IsTrue(streamReader.ReadBinaryDataView(gltfDoc, gltfDoc.images.Get("0"), byteLength) == nullptr);
+
+                    for (auto reader : { &memoryReader, &streamReader, &randomAccessReader })
+                    {
+                        for (size_t i = 0U; i < expected.size(); ++i)
+                        {
+                            std::vector<uint8_t> data;
+                            size_t chunkCount = 0U;
+
+                            const size_t imageByteLength = reader->ReadBinaryDataChunked(gltfDoc, gltfDoc.images.Get(std::to_string(i)), [&](const uint8_t* chunk, size_t byteCount)
+                            {
+                                Assert::IsTrue(byteCount <= 3U);
+
+                                data.insert(data.end(), chunk, chunk + byteCount);
+                                ++chunkCount;
+                            }, 3U);
+
+                            Assert::AreEqual(expected[i].size(), imageByteLength);
+                            Assert::AreEqual((imageByteLength + 2U) / 3U, chunkCount);
+                            Assert::IsTrue(data == expected[i]);
+                        }
+                    }
+                }
+
                 GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseAccessorUint8)
                 {
                     uint8_t inputBuffer[16] = { 3U, 3U, 3U, 3U, // the sparse values
@@ -576,6 +826,581 @@ namespace Microsoft
 
                     Assert::IsTrue(output == expectedReadOutput);
                 }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataViewMemoryStream)
+                {
+                    auto data = MakeBufferData(std::vector<float>{ 1.0f, 2.0f, 3.0f, 4.0f });
+
+                    auto streamReader = std::make_shared<MemoryStreamReader>();
+                    streamReader->Add("buffer.bin", data);
+
+                    Document gltfDoc = CreateFloatAccessorDocument(data->size(), 2U, TYPE_VEC2);
+
+                    GLTFResourceReader gltfResourceReader(streamReader);
+
+                    auto view = gltfResourceReader.ReadBinaryDataView<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+
+                    // The view should point directly into the memory returned by the stream reader
+                    Assert::IsTrue(view.Data() == reinterpret_cast<const float*>(data->data()));
+                    Assert::IsTrue(view.IsContiguous());
+                    Assert::AreEqual<size_t>(2U, view.GetCount());
+                    Assert::AreEqual<size_t>(2U, view.GetTypeCount());
+                    Assert::IsTrue(view.GetComponentType() == COMPONENT_FLOAT);
+                    Assert::AreEqual<float>(3.0f, view.Get(1U, 0U));
+                    Assert::AreEqual<float>(4.0f, view.Get(1U, 1U));
+
+                    auto output = gltfResourceReader.ReadBinaryData<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+
+                    Assert::IsTrue(output == view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataViewInterleaved)
+                {
+                    // Two vertices, each a VEC3 position followed by a VEC2 texcoord
+                    auto data = MakeBufferData(std::vector<float>{
+                        1.0f, 2.0f, 3.0f, 0.25f, 0.5f,
+                        4.0f, 5.0f, 6.0f, 0.75f, 1.0f });
+
+                    auto streamReader = std::make_shared<MemoryStreamReader>();
+                    streamReader->Add("buffer.bin", data);
+
+                    Document gltfDoc = CreateFloatAccessorDocument(data->size(), 2U, TYPE_VEC2, 12U, 20U);
+
+                    GLTFResourceReader gltfResourceReader(streamReader);
+
+                    auto view = gltfResourceReader.ReadBinaryDataView<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+
+                    Assert::IsFalse(view.IsContiguous());
+                    Assert::AreEqual<size_t>(20U, view.GetByteStride());
+                    Assert::IsTrue(view.GetElement(0U) == reinterpret_cast<const float*>(data->data() + 12U));
+                    Assert::IsTrue(view.ToVector() == std::vector<float>{ 0.25f, 0.5f, 0.75f, 1.0f });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataViewStringStream)
+                {
+                    std::vector<float> values = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    stream->GetOutputStream("buffer.bin")->write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+
+                    Document gltfDoc = CreateFloatAccessorDocument(values.size() * sizeof(float), 2U, TYPE_VEC3);
+
+                    GLTFResourceReader gltfResourceReader(stream);
+
+                    // The data isn't resident in memory so the view owns a copy
+                    auto view = gltfResourceReader.ReadBinaryDataView<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+
+                    Assert::IsTrue(view.IsContiguous());
+                    Assert::AreEqual<size_t>(2U, view.GetCount());
+                    Assert::IsTrue(view.ToVector() == values);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataViewOutOfRange)
+                {
+                    // The buffer declares a larger byteLength than the data that is actually available
+                    auto data = MakeBufferData(std::vector<float>{ 1.0f, 2.0f });
+
+                    auto streamReader = std::make_shared<MemoryStreamReader>();
+                    streamReader->Add("buffer.bin", data);
+
+                    Document gltfDoc = CreateFloatAccessorDocument(16U, 2U, TYPE_VEC2);
+
+                    GLTFResourceReader gltfResourceReader(streamReader);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        gltfResourceReader.ReadBinaryDataView<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataInterleavedStream)
+                {
+                    // Enough VEC3 position + VEC2 texcoord vertices that the interleaved data spans multiple block reads
+                    const size_t vertexCount = 100000U;
+
+                    std::vector<float> vertices;
+                    std::vector<float> expected;
+
+                    for (size_t i = 0U; i < vertexCount; ++i)
+                    {
+                        const float value = static_cast<float>(i);
+
+                        vertices.insert(vertices.end(), { value, value + 0.1f, value + 0.2f, -value, value * 0.5f });
+                        expected.insert(expected.end(), { -value, value * 0.5f });
+                    }
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    stream->GetOutputStream("buffer.bin")->write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(float));
+
+                    Document gltfDoc = CreateFloatAccessorDocument(vertices.size() * sizeof(float), vertexCount, TYPE_VEC2, 12U, 20U);
+
+                    GLTFResourceReader gltfResourceReader(stream);
+
+                    auto output = gltfResourceReader.ReadBinaryData<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+
+                    Assert::IsTrue(output == expected);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataInterleavedBase64)
+                {
+                    // The base64 string encodes the bytes 0 to 11, the accessor reads 3 VEC2 elements with a stride of 4 starting at byte 1
+                    Document gltfDoc = CreateAccessorDocument("data:application/octet-stream;base64,AAECAwQFBgcICQoL", 12U, TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, 3U, 1U, 4U);
+
+                    GLTFResourceReader gltfResourceReader(std::make_shared<StreamReaderWriter>());
+
+                    auto output = gltfResourceReader.ReadBinaryData<uint8_t>(gltfDoc, gltfDoc.accessors.Get("0"));
+
+                    Assert::IsTrue(output == std::vector<uint8_t>{ 1U, 2U, 5U, 6U, 9U, 10U });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataBase64Cache)
+                {
+                    Document gltfDoc = CreateAccessorDocument("data:application/octet-stream;base64,AAECAwQFBgcICQoL", 12U, TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, 3U, 1U, 4U);
+
+                    GLTFResourceReader gltfResourceReader(std::make_shared<StreamReaderWriter>());
+                    gltfResourceReader.EnableBase64Cache(1024U);
+
+                    const auto& accessor = gltfDoc.accessors.Get("0");
+
+                    auto output = gltfResourceReader.ReadBinaryData<uint8_t>(gltfDoc, accessor);
+                    Assert::IsTrue(output == std::vector<uint8_t>{ 1U, 2U, 5U, 6U, 9U, 10U });
+
+                    // The whole buffer is decoded once and cached
+                    Assert::AreEqual<size_t>(1U, gltfResourceReader.GetBase64Cache()->Size());
+                    Assert::AreEqual<size_t>(Base64BufferCache::GetEntryByteCount(gltfDoc.buffers.Front(), 12U), gltfResourceReader.GetBase64Cache()->GetByteCount());
+
+                    auto bufferViewData = gltfResourceReader.ReadBinaryData<uint8_t>(gltfDoc, gltfDoc.bufferViews.Get("0"));
+                    Assert::IsTrue(bufferViewData == std::vector<uint8_t>{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U });
+
+                    // Views of cached buffers reference the decoded data directly
+                    auto view1 = gltfResourceReader.ReadBinaryDataView<uint8_t>(gltfDoc, accessor);
+                    auto view2 = gltfResourceReader.ReadBinaryDataView<uint8_t>(gltfDoc, accessor);
+
+                    Assert::IsTrue(view1.Data() == view2.Data());
+                    Assert::IsTrue(view1.ToVector() == output);
+                    Assert::AreEqual<size_t>(1U, gltfResourceReader.GetBase64Cache()->Size());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataBase64CacheOverBudget)
+                {
+                    Document gltfDoc = CreateAccessorDocument("data:application/octet-stream;base64,AAECAwQFBgcICQoL", 12U, TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, 3U, 1U, 4U);
+
+                    GLTFResourceReader gltfResourceReader(std::make_shared<StreamReaderWriter>());
+                    gltfResourceReader.EnableBase64Cache(8U);
+
+                    // The buffer is larger than the budget so isn't cached, but can still be read
+                    auto output = gltfResourceReader.ReadBinaryData<uint8_t>(gltfDoc, gltfDoc.accessors.Get("0"));
+
+                    Assert::IsTrue(output == std::vector<uint8_t>{ 1U, 2U, 5U, 6U, 9U, 10U });
+                    Assert::AreEqual<size_t>(0U, gltfResourceReader.GetBase64Cache()->Size());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataBatch)
+                {
+                    // Three uint16 indices (padded to 8 bytes) followed by three interleaved VEC3 position + VEC2 texcoord vertices
+                    std::vector<uint16_t> indices = { 0U, 1U, 2U, 0U };
+                    std::vector<float> vertices = {
+                        1.0f, 2.0f, 3.0f, 0.25f, 0.5f,
+                        4.0f, 5.0f, 6.0f, 0.75f, 1.0f,
+                        7.0f, 8.0f, 9.0f, 0.0f, 0.125f };
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto outputStream = stream->GetOutputStream("buffer.bin");
+                    outputStream->write(reinterpret_cast<const char*>(indices.data()), indices.size() * sizeof(uint16_t));
+                    outputStream->write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(float));
+
+                    Document gltfDoc = CreateAccessorDocument("buffer.bin", 68U, TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT, 3U);
+
+                    BufferView bufferView;
+                    bufferView.id = "1";
+                    bufferView.bufferId = "0";
+                    bufferView.byteOffset = 8U;
+                    bufferView.byteLength = 60U;
+                    bufferView.byteStride = 20U;
+                    gltfDoc.bufferViews.Append(std::move(bufferView));
+
+                    Accessor positions;
+                    positions.id = "1";
+                    positions.bufferViewId = "1";
+                    positions.componentType = COMPONENT_FLOAT;
+                    positions.count = 3U;
+                    positions.type = TYPE_VEC3;
+                    gltfDoc.accessors.Append(std::move(positions));
+
+                    Accessor texCoords;
+                    texCoords.id = "2";
+                    texCoords.bufferViewId = "1";
+                    texCoords.byteOffset = 12U;
+                    texCoords.componentType = COMPONENT_FLOAT;
+                    texCoords.count = 3U;
+                    texCoords.type = TYPE_VEC2;
+                    gltfDoc.accessors.Append(std::move(texCoords));
+
+                    GLTFResourceReader gltfResourceReader(stream);
+
+                    auto output = gltfResourceReader.ReadBinaryDataBatch(gltfDoc, { "1", "2", "0", "1" }, 4U);
+
+                    Assert::AreEqual<size_t>(4U, output.size());
+
+                    Assert::IsTrue(output[0].GetType() == TYPE_VEC3);
+                    Assert::AreEqual<size_t>(3U, output[0].GetCount());
+                    Assert::IsTrue(output[0].ToVector<float>() == gltfResourceReader.ReadBinaryData<float>(gltfDoc, gltfDoc.accessors.Get("1")));
+                    Assert::IsTrue(output[1].ToVector<float>() == std::vector<float>{ 0.25f, 0.5f, 0.75f, 1.0f, 0.0f, 0.125f });
+                    Assert::IsTrue(output[2].ToVector<uint16_t>() == std::vector<uint16_t>{ 0U, 1U, 2U });
+
+                    // Repeated accessor ids share the same data
+                    Assert::IsTrue(output[3].Data() == output[0].Data());
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        output[2].ToVector<float>();
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataBatchCoalescesGaps)
+                {
+                    // Two VEC2 float accessors separated by a 16 byte gap, and a third 1040 bytes further on
+                    std::vector<float> values(280U);
+
+                    for (size_t i = 0U; i < values.size(); ++i)
+                    {
+                        values[i] = static_cast<float>(i);
+                    }
+
+                    auto streamReader = std::make_shared<StringStreamReader>();
+                    streamReader->Add("buffer.bin", std::string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float)));
+
+                    auto randomAccessReader = std::make_shared<RecordingRandomAccessReader>(std::make_shared<StreamRandomAccessReader>(streamReader));
+
+                    Document gltfDoc = CreateFloatAccessorDocument(values.size() * sizeof(float), 2U, TYPE_VEC2);
+
+                    for (auto byteOffset : { 32U, 1088U })
+                    {
+                        Accessor accessor;
+                        accessor.id = std::to_string(gltfDoc.accessors.Size());
+                        accessor.bufferViewId = "0";
+                        accessor.byteOffset = byteOffset;
+                        accessor.componentType = COMPONENT_FLOAT;
+                        accessor.count = 2U;
+                        accessor.type = TYPE_VEC2;
+                        gltfDoc.accessors.Append(std::move(accessor));
+                    }
+
+                    GLTFResourceReader gltfResourceReader(randomAccessReader);
+
+                    gltfResourceReader.SetMaxReadGap(2048U);
+
+                    auto output = gltfResourceReader.ReadBinaryDataBatch(gltfDoc, { "2", "0", "1" }, 1U);
+
+                    Assert::AreEqual<size_t>(1U, randomAccessReader->m_reads.size());
+                    Assert::AreEqual<size_t>(0U, randomAccessReader->m_reads[0].byteBegin);
+                    Assert::AreEqual<size_t>(1104U, randomAccessReader->m_reads[0].byteEnd);
+
+                    Assert::IsTrue(output[0].ToVector<float>() == std::vector<float>{ 272.0f, 273.0f, 274.0f, 275.0f });
+                    Assert::IsTrue(output[1].ToVector<float>() == std::vector<float>{ 0.0f, 1.0f, 2.0f, 3.0f });
+                    Assert::IsTrue(output[2].ToVector<float>() == std::vector<float>{ 8.0f, 9.0f, 10.0f, 11.0f });
+
+                    // A smaller gap threshold only merges the first two accessors
+                    randomAccessReader->m_reads.clear();
+                    gltfResourceReader.SetMaxReadGap(16U);
+
+                    output = gltfResourceReader.ReadBinaryDataBatch(gltfDoc, { "2", "0", "1" }, 1U);
+
+                    Assert::AreEqual<size_t>(2U, randomAccessReader->m_reads.size());
+                    Assert::AreEqual<size_t>(48U, randomAccessReader->m_reads[0].byteEnd);
+                    Assert::AreEqual<size_t>(1088U, randomAccessReader->m_reads[1].byteBegin);
+                    Assert::IsTrue(output[0].ToVector<float>() == std::vector<float>{ 272.0f, 273.0f, 274.0f, 275.0f });
+                    Assert::IsTrue(output[2].ToVector<float>() == std::vector<float>{ 8.0f, 9.0f, 10.0f, 11.0f });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataBatchMeshPrimitive)
+                {
+                    Document gltfDoc = CreateAccessorDocument("data:application/octet-stream;base64,AAECAwQFBgcICQoL", 12U, TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, 3U, 1U, 4U);
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = "0";
+
+                    GLTFResourceReader gltfResourceReader(std::make_shared<StreamReaderWriter>());
+
+                    auto output = gltfResourceReader.ReadBinaryDataBatch(gltfDoc, meshPrimitive);
+
+                    Assert::AreEqual<size_t>(1U, output.size());
+                    Assert::IsTrue(output.at("0").ToVector<uint8_t>() == std::vector<uint8_t>{ 1U, 2U, 5U, 6U, 9U, 10U });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataAsync)
+                {
+                    std::vector<float> values = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+
+                    auto streamReader = std::make_shared<StringStreamReader>();
+                    streamReader->Add("buffer.bin", std::string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float)));
+
+                    Document gltfDoc = CreateFloatAccessorDocument(values.size() * sizeof(float), 2U, TYPE_VEC3);
+
+                    GLTFResourceReader gltfResourceReader(MakeStreamReaderCache<StreamReaderCacheThreadLocal>(streamReader));
+                    ThreadPoolExecutor executor(2U);
+
+                    const auto& accessor = gltfDoc.accessors.Get("0");
+
+                    auto accessorFuture = gltfResourceReader.ReadBinaryDataAsync<float>(gltfDoc, accessor, executor);
+                    auto bufferViewFuture = gltfResourceReader.ReadBinaryDataAsync<float>(gltfDoc, gltfDoc.bufferViews.Get("0"), executor);
+
+                    Assert::IsTrue(accessorFuture.get() == values);
+                    Assert::IsTrue(bufferViewFuture.get() == values);
+
+                    std::promise<std::vector<float>> callbackPromise;
+
+                    gltfResourceReader.ReadBinaryDataAsync<float>(gltfDoc, accessor, executor, [&callbackPromise](std::vector<float> data, std::exception_ptr exception)
+                    {
+                        if (exception)
+                        {
+                            callbackPromise.set_exception(exception);
+                        }
+                        else
+                        {
+                            callbackPromise.set_value(std::move(data));
+                        }
+                    });
+
+                    Assert::IsTrue(callbackPromise.get_future().get() == values);
+
+                    // Errors are reported via the future rather than thrown by ReadBinaryDataAsync
+                    auto invalidFuture = gltfResourceReader.ReadBinaryDataAsync<uint8_t>(gltfDoc, accessor, executor);
+
+                    Assert::ExpectException<GLTFException>([&invalidFuture]()
+                    {
+                        invalidFuture.get();
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataBatchExecutor)
+                {
+                    Document gltfDoc = CreateAccessorDocument("data:application/octet-stream;base64,AAECAwQFBgcICQoL", 12U, TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, 3U, 1U, 4U);
+
+                    GLTFResourceReader gltfResourceReader(std::make_shared<StreamReaderWriter>());
+
+                    // The batch is issued from the executor's only worker thread, the work must still complete
+                    ThreadPoolExecutor executor(1U);
+                    std::promise<std::vector<AccessorData>> promise;
+
+                    executor.Execute([&]()
+                    {
+                        promise.set_value(gltfResourceReader.ReadBinaryDataBatch(gltfDoc, { "0", "0" }, executor));
+                    });
+
+                    auto output = promise.get_future().get();
+
+                    Assert::AreEqual<size_t>(2U, output.size());
+                    Assert::IsTrue(output[0].ToVector<uint8_t>() == std::vector<uint8_t>{ 1U, 2U, 5U, 6U, 9U, 10U });
+                    Assert::IsTrue(output[1].Data() == output[0].Data());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataRandomAccessReader)
+                {
+                    // Two vertices, each a VEC3 position followed by a VEC2 texcoord
+                    std::vector<float> vertices = {
+                        1.0f, 2.0f, 3.0f, 0.25f, 0.5f,
+                        4.0f, 5.0f, 6.0f, 0.75f, 1.0f };
+
+                    auto streamReader = std::make_shared<StringStreamReader>();
+                    streamReader->Add("buffer.bin", std::string(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(float)));
+
+                    auto randomAccessReader = std::make_shared<StreamRandomAccessReader>(streamReader);
+
+                    Assert::AreEqual(vertices.size() * sizeof(float), randomAccessReader->Size("buffer.bin"));
+
+                    Document gltfDoc = CreateFloatAccessorDocument(vertices.size() * sizeof(float), 2U, TYPE_VEC2, 12U, 20U);
+
+                    GLTFResourceReader gltfResourceReader(randomAccessReader);
+
+                    auto output = gltfResourceReader.ReadBinaryData<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+                    Assert::IsTrue(output == std::vector<float>{ 0.25f, 0.5f, 0.75f, 1.0f });
+
+                    auto bufferViewData = gltfResourceReader.ReadBinaryData<float>(gltfDoc, gltfDoc.bufferViews.Get("0"));
+                    Assert::IsTrue(bufferViewData == vertices);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataConcurrent)
+                {
+                    // VEC3 position + VEC2 texcoord vertices, each thread reads the accessor of the whole interleaved buffer view
+                    const size_t vertexCount = 1000U;
+
+                    std::vector<float> vertices;
+                    std::vector<float> expected;
+
+                    for (size_t i = 0U; i < vertexCount; ++i)
+                    {
+                        const float value = static_cast<float>(i);
+
+                        vertices.insert(vertices.end(), { value, value + 0.1f, value + 0.2f, -value, value * 0.5f });
+                        expected.insert(expected.end(), { -value, value * 0.5f });
+                    }
+
+                    auto streamReader = std::make_shared<StringStreamReader>();
+                    streamReader->Add("buffer.bin", std::string(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(float)));
+
+                    Document gltfDoc = CreateFloatAccessorDocument(vertices.size() * sizeof(float), vertexCount, TYPE_VEC2, 12U, 20U);
+
+                    GLTFResourceReader gltfResourceReader(MakeStreamReaderCache<StreamReaderCacheThreadLocal>(streamReader));
+
+                    const auto& accessor = gltfDoc.accessors.Get("0");
+
+                    const size_t threadCount = 4U;
+                    const size_t readCount = 50U;
+
+                    std::atomic<size_t> matchCount(0U);
+                    std::vector<std::thread> threads;
+
+                    for (size_t i = 0U; i < threadCount; ++i)
+                    {
+                        threads.emplace_back([&]()
+                        {
+                            for (size_t j = 0U; j < readCount; ++j)
+                            {
+                                if (gltfResourceReader.ReadBinaryData<float>(gltfDoc, accessor) == expected)
+                                {
+                                    ++matchCount;
+                                }
+                            }
+                        });
+                    }
+
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    Assert::AreEqual(threadCount * readCount, matchCount.load());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestApplySparseBinaryData)
+                {
+                    // Indices 1 and 3 followed by two VEC3 values
+                    std::vector<uint16_t> indices = { 1U, 3U };
+                    std::vector<float> values = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+
+                    auto data = std::make_shared<std::vector<uint8_t>>(*MakeBufferData(indices));
+                    auto valuesData = MakeBufferData(values);
+                    data->insert(data->end(), valuesData->begin(), valuesData->end());
+
+                    Document gltfDoc = CreateSparseAccessorDocument("buffer.bin", 4U, 2U);
+                    const auto& accessor = gltfDoc.accessors.Get("0");
+
+                    std::vector<float> expected = {
+                        0.0f, 0.0f, 0.0f,
+                        1.0f, 2.0f, 3.0f,
+                        0.0f, 0.0f, 0.0f,
+                        4.0f, 5.0f, 6.0f };
+
+                    // The values are scattered directly from a MemoryStream's data, or from a copy read from a stream
+                    auto memoryStreamReader = std::make_shared<MemoryStreamReader>();
+                    memoryStreamReader->Add("buffer.bin", data);
+
+                    auto stringStreamReader = std::make_shared<StringStreamReader>();
+                    stringStreamReader->Add("buffer.bin", std::string(data->begin(), data->end()));
+
+                    GLTFResourceReader memoryResourceReader(memoryStreamReader);
+                    GLTFResourceReader streamResourceReader(stringStreamReader);
+
+                    for (const auto gltfResourceReader : { &memoryResourceReader, &streamResourceReader })
+                    {
+                        Assert::IsTrue(gltfResourceReader->ReadBinaryData<float>(gltfDoc, accessor) == expected);
+
+                        // Only the sparse elements are written, the others keep their existing values
+                        std::vector<float> output(12U, -1.0f);
+                        Assert::AreEqual<size_t>(2U, gltfResourceReader->ApplySparseBinaryData<float>(gltfDoc, accessor, output.data(), output.size()));
+                        Assert::IsTrue(output == std::vector<float>{ -1.0f, -1.0f, -1.0f, 1.0f, 2.0f, 3.0f, -1.0f, -1.0f, -1.0f, 4.0f, 5.0f, 6.0f });
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseBinaryDataView)
+                {
+                    // Indices 1 and 3 followed by two VEC3 values
+                    std::vector<uint16_t> indices = { 1U, 3U };
+                    std::vector<float> values = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+
+                    auto data = std::make_shared<std::vector<uint8_t>>(*MakeBufferData(indices));
+                    auto valuesData = MakeBufferData(values);
+                    data->insert(data->end(), valuesData->begin(), valuesData->end());
+
+                    auto streamReader = std::make_shared<MemoryStreamReader>();
+                    streamReader->Add("buffer.bin", data);
+
+                    Document gltfDoc = CreateSparseAccessorDocument("buffer.bin", 1000U, 2U);
+                    const auto& accessor = gltfDoc.accessors.Get("0");
+
+                    GLTFResourceReader gltfResourceReader(streamReader);
+
+                    auto view = gltfResourceReader.ReadSparseBinaryDataView<float>(gltfDoc, accessor);
+
+                    Assert::IsTrue(view.IsBaseZero());
+                    Assert::AreEqual<size_t>(1000U, view.GetCount());
+                    Assert::AreEqual<size_t>(3U, view.GetTypeCount());
+                    Assert::IsTrue(view.GetIndices() == std::vector<uint32_t>{ 1U, 3U });
+
+                    // The values point directly into the memory returned by the stream reader
+                    Assert::IsTrue(view.GetValues().Data() == reinterpret_cast<const float*>(data->data() + 4U));
+                    Assert::AreEqual<float>(5.0f, view.Get(3U, 1U));
+                    Assert::AreEqual<float>(0.0f, view.Get(2U, 1U));
+
+                    Assert::IsTrue(view.ToVector() == gltfResourceReader.ReadBinaryData<float>(gltfDoc, accessor));
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseIndexOutOfRange)
+                {
+                    std::vector<uint16_t> indices = { 1U, 4U };
+                    std::vector<float> values = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+
+                    auto data = std::make_shared<std::vector<uint8_t>>(*MakeBufferData(indices));
+                    auto valuesData = MakeBufferData(values);
+                    data->insert(data->end(), valuesData->begin(), valuesData->end());
+
+                    auto streamReader = std::make_shared<MemoryStreamReader>();
+                    streamReader->Add("buffer.bin", data);
+
+                    Document gltfDoc = CreateSparseAccessorDocument("buffer.bin", 4U, 2U);
+
+                    GLTFResourceReader gltfResourceReader(streamReader);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        gltfResourceReader.ReadBinaryData<float>(gltfDoc, gltfDoc.accessors.Get("0"));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataDestination)
+                {
+                    // Two vertices, each a VEC3 position followed by a VEC2 texcoord
+                    std::vector<float> vertices = {
+                        1.0f, 2.0f, 3.0f, 0.25f, 0.5f,
+                        4.0f, 5.0f, 6.0f, 0.75f, 1.0f };
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+                    streamOutput->write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(float));
+
+                    Document gltfDoc = CreateFloatAccessorDocument(vertices.size() * sizeof(float), 2U, TYPE_VEC2, 12U, 20U);
+
+                    GLTFResourceReader gltfResourceReader(stream);
+
+                    const auto& accessor = gltfDoc.accessors.Get("0");
+
+                    // The values following the accessor's data must be left untouched
+                    std::vector<float> destination(6U, -1.0f);
+
+                    Assert::AreEqual<size_t>(4U, gltfResourceReader.ReadBinaryData<float>(gltfDoc, accessor, destination.data(), destination.size()));
+                    Assert::IsTrue(destination == std::vector<float>{ 0.25f, 0.5f, 0.75f, 1.0f, -1.0f, -1.0f });
+
+                    std::vector<float> bufferViewDestination(vertices.size());
+
+                    Assert::AreEqual(vertices.size(), gltfResourceReader.ReadBinaryData<float>(gltfDoc, gltfDoc.bufferViews.Get("0"), bufferViewDestination.data(), bufferViewDestination.size()));
+                    Assert::IsTrue(bufferViewDestination == vertices);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        gltfResourceReader.ReadBinaryData<float>(gltfDoc, accessor, destination.data(), 3U);
+                    });
+                }
             };
         }
     }
@@ -9,6 +9,7 @@
 #include <GLTFSDK/GLBResourceReader.h>
 #include <GLTFSDK/GLBResourceWriter.h>
 #include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/SchemaValidation.h>
 #include <GLTFSDK/Serialize.h>
 
 #include "TestResources.h"
@@ -691,6 +692,32 @@ namespace Microsoft
                     Assert::IsTrue(document.nodes.Size() == 1U);
                     Assert::IsTrue(document.nodes.Front().children.empty()); // Assert that the node has no children
                 }
+
+                GLTFSDK_TEST_METHOD(GLTFTests, SchemaCacheCompiledSchema)
+                {
+                    SchemaCache schemaCache;
+
+                    // Each set of flags is compiled once
+                    auto schema = schemaCache.Get(SchemaFlags::None);
+                    Assert::IsTrue(schema == schemaCache.Get(SchemaFlags::None));
+                    Assert::IsTrue(schema != schemaCache.Get(SchemaFlags::DisableSchemaNode));
+                    Assert::AreEqual<size_t>(2U, schemaCache.Size());
+
+                    // A compiled schema can be reused by any number of Deserialize calls
+                    Assert::ExpectException<ValidationException>([&schema, json = asset_invalid_version]()
+                    {
+                        Deserialize(json, ExtensionDeserializer(), *schema);
+                    });
+
+                    Assert::ExpectException<ValidationException>([&schema, json = node_invalid_children]()
+                    {
+                        Deserialize(json, ExtensionDeserializer(), *schema, DeserializeFlags::Streaming);
+                    });
+
+                    auto document = Deserialize(node_invalid_children, ExtensionDeserializer(), *schemaCache.Get(SchemaFlags::DisableSchemaNode));
+
+                    Assert::IsTrue(document.nodes.Size() == 1U);
+                }
             };
         }
     }
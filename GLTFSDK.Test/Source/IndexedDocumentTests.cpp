@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/IndexedDocument.h>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // Creates a document with a mesh instanced by two child nodes, using ids that aren't indices
+    Document CreateMeshDocument()
+    {
+        Document document;
+
+        Buffer buffer;
+        buffer.id = "buffer";
+        document.buffers.Append(std::move(buffer));
+
+        BufferView bufferView;
+        bufferView.id = "bufferView";
+        bufferView.bufferId = "buffer";
+        document.bufferViews.Append(std::move(bufferView));
+
+        for (auto id : { "indices", "positions", "normals" })
+        {
+            Accessor accessor;
+            accessor.id = id;
+            accessor.bufferViewId = "bufferView";
+            document.accessors.Append(std::move(accessor));
+        }
+
+        Material material;
+        material.id = "material";
+        document.materials.Append(std::move(material));
+
+        MeshPrimitive meshPrimitive;
+        meshPrimitive.attributes[ACCESSOR_POSITION] = "positions";
+        meshPrimitive.attributes[ACCESSOR_NORMAL] = "normals";
+        meshPrimitive.indicesAccessorId = "indices";
+        meshPrimitive.materialId = "material";
+
+        Mesh mesh;
+        mesh.id = "mesh";
+        mesh.primitives.push_back(std::move(meshPrimitive));
+        document.meshes.Append(std::move(mesh));
+
+        Node root;
+        root.id = "root";
+        root.children = { "child1", "child2" };
+        document.nodes.Append(std::move(root));
+
+        for (auto id : { "child1", "child2" })
+        {
+            Node child;
+            child.id = id;
+            child.meshId = "mesh";
+            document.nodes.Append(std::move(child));
+        }
+
+        Scene scene;
+        scene.id = "scene";
+        scene.nodes = { "root" };
+        document.SetDefaultScene(std::move(scene));
+
+        return document;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(IndexedDocumentTests)
+            {
+                GLTFSDK_TEST_METHOD(IndexedDocumentTests, IndexedDocumentReferences)
+                {
+                    const Document document = CreateMeshDocument();
+                    const IndexedDocument indexedDocument(document);
+
+                    Assert::AreEqual<uint32_t>(0U, indexedDocument.defaultScene);
+                    Assert::IsTrue(indexedDocument.scenes[0].nodes == std::vector<uint32_t>{ 0U });
+
+                    const auto& root = indexedDocument.nodes[0];
+
+                    Assert::IsTrue(root.children == std::vector<uint32_t>{ 1U, 2U });
+                    Assert::AreEqual<uint32_t>(IndexedDocument::InvalidIndex, root.mesh);
+                    Assert::AreEqual<uint32_t>(IndexedDocument::InvalidIndex, root.camera);
+
+                    for (auto child : root.children)
+                    {
+                        Assert::AreEqual<uint32_t>(0U, indexedDocument.nodes[child].mesh);
+                    }
+
+                    const auto& meshPrimitive = indexedDocument.meshes[0].primitives[0];
+
+                    Assert::AreEqual<uint32_t>(0U, meshPrimitive.indicesAccessor);
+                    Assert::AreEqual<uint32_t>(0U, meshPrimitive.material);
+                    Assert::AreEqual<uint32_t>(1U, meshPrimitive.GetAttributeAccessor(ACCESSOR_POSITION));
+                    Assert::AreEqual<uint32_t>(2U, meshPrimitive.GetAttributeAccessor(ACCESSOR_NORMAL));
+                    Assert::AreEqual<uint32_t>(IndexedDocument::InvalidIndex, meshPrimitive.GetAttributeAccessor(ACCESSOR_TEXCOORD_0));
+
+                    // The indices refer to the document's elements
+                    Assert::AreEqual(std::string("positions"), document.accessors[meshPrimitive.GetAttributeAccessor(ACCESSOR_POSITION)].id);
+                    Assert::AreEqual<uint32_t>(0U, indexedDocument.accessors[1].bufferView);
+                    Assert::AreEqual<uint32_t>(IndexedDocument::InvalidIndex, indexedDocument.accessors[1].sparseValuesBufferView);
+                    Assert::AreEqual<uint32_t>(0U, indexedDocument.bufferViews[0].buffer);
+                }
+
+                GLTFSDK_TEST_METHOD(IndexedDocumentTests, IndexedDocumentMissingReference)
+                {
+                    Document document = CreateMeshDocument();
+
+                    Node node;
+                    node.id = "missing";
+                    node.children = { "child3" };
+                    document.nodes.Append(std::move(node));
+
+                    Assert::ExpectException<GLTFException>([&document]()
+                    {
+                        IndexedDocument indexedDocument(document);
+                    });
+                }
+            };
+        }
+    }
+}
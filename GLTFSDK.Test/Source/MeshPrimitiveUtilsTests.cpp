@@ -351,6 +351,37 @@ namespace Microsoft
                     AreEqual(expected, output);
                 }
 
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetTexcoords_Vec2_Unsigned_Byte_Destination)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<uint8_t> texcoords = {
+                        0, 255,
+                        51, 102
+                    };
+                    auto accessor = bufferBuilder.AddAccessor(texcoords, { TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, true });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    std::vector<float> output(5U, -1.0f);
+                    Assert::AreEqual<size_t>(4U, MeshPrimitiveUtils::GetTexCoords(doc, reader, accessor, output.data(), output.size()));
+
+                    std::vector<float> expected = { 0.0f, 1.0f, 0.2f, 0.4f, -1.0f };
+                    AreEqual(expected, output);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetTexCoords(doc, reader, accessor, output.data(), 3U);
+                    });
+                }
+
                 GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetTexcoords_Vec2_Unsigned_Short)
                 {
                     auto readerWriter = std::make_shared<const StreamReaderWriter>();
@@ -560,6 +591,44 @@ namespace Microsoft
                     AreEqual(expected, output);
                 }
 
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetColors_Vec4_Unsigned_Short_Long)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    // Enough colors for the vectorized conversion to be used, including values that round halfway
+                    std::vector<uint16_t> colors(4U * 37U);
+                    for (size_t i = 0; i < colors.size(); i++)
+                    {
+                        colors[i] = static_cast<uint16_t>(i * 257U + (i % 3 == 0 ? 128U : 0U));
+                    }
+                    auto accessor = bufferBuilder.AddAccessor(colors, { TYPE_VEC4, COMPONENT_UNSIGNED_SHORT, true });
+
+                    // The same colors one at a time, which are converted by the scalar path
+                    std::vector<Accessor> colorAccessors;
+                    for (size_t i = 0; i < colors.size(); i += 4)
+                    {
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        colorAccessors.push_back(bufferBuilder.AddAccessor(&colors[i], 1U, { TYPE_VEC4, COMPONENT_UNSIGNED_SHORT, true }));
+                    }
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+                    auto output = MeshPrimitiveUtils::GetColors(doc, reader, accessor);
+
+                    std::vector<uint32_t> expected;
+                    for (const auto& colorAccessor : colorAccessors)
+                    {
+                        expected.push_back(MeshPrimitiveUtils::GetColors(doc, reader, colorAccessor).front());
+                    }
+                    AreEqual(expected, output);
+                }
+
                 GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetJointIndices32_Vec4_Unsigned_Byte)
                 {
                     auto readerWriter = std::make_shared<const StreamReaderWriter>();
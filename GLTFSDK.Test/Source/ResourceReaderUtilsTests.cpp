@@ -3,12 +3,14 @@
 
 #include "stdafx.h"
 
+#include <GLTFSDK/Base64BufferCache.h>
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/GLTFResourceReader.h>
 #include <GLTFSDK/ResourceReaderUtils.h>
 
 #include "TestUtils.h"
 
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -320,6 +322,72 @@ namespace Microsoft
                     }
                 }
 
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestAllCharLongString)
+                {
+                    // Place each possible char value within a string long enough to be decoded by the vectorized decoders
+                    const auto decodeTable = GetDecodeTable();
+
+                    for (int i = 0; i < 256; i++)
+                    {
+                        std::string encoded_string(128U, 'A');
+                        encoded_string[70] = static_cast<char>(i);
+
+                        if (i < 128 && decodeTable[i] != std::numeric_limits<uint8_t>::max())
+                        {
+                            // 'A' decodes to zero so only the bits of the replaced character are set
+                            auto decoded = Base64Decode(encoded_string);
+                            Assert::IsTrue(decoded[52] == static_cast<uint8_t>(decodeTable[i] >> 2));
+                            Assert::IsTrue(decoded[53] == static_cast<uint8_t>((decodeTable[i] & 0x3) << 6));
+                        }
+                        else
+                        {
+                            Assert::ExpectException<GLTFException>([encoded_string]()
+                            {
+                                Base64Decode(encoded_string);
+                            });
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestBase64Encode)
+                {
+                    // Test vectors from RFC 4648
+                    Assert::AreEqual("", Base64Encode(std::vector<uint8_t>()).c_str());
+                    Assert::AreEqual("Zg==", Base64Encode("f", 1U).c_str());
+                    Assert::AreEqual("Zm8=", Base64Encode("fo", 2U).c_str());
+                    Assert::AreEqual("Zm9v", Base64Encode("foo", 3U).c_str());
+                    Assert::AreEqual("Zm9vYg==", Base64Encode("foob", 4U).c_str());
+                    Assert::AreEqual("Zm9vYmE=", Base64Encode("fooba", 5U).c_str());
+                    Assert::AreEqual("Zm9vYmFy", Base64Encode("foobar", 6U).c_str());
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestBase64EncodeDecodeRoundTrip)
+                {
+                    std::vector<uint8_t> data(1000U);
+
+                    for (size_t i = 0; i < data.size(); i++)
+                    {
+                        data[i] = static_cast<uint8_t>((i * 7919U) >> 3);
+                    }
+
+                    // Cover every combination of lengths and leading bytes to skip that the vectorized and scalar decoders handle differently
+                    for (size_t length = 0; length <= data.size(); length += 37U)
+                    {
+                        const std::vector<uint8_t> expected(data.begin(), data.begin() + length);
+                        const std::string encoded = Base64Encode(expected);
+
+                        Assert::IsTrue(Base64Decode(encoded) == expected);
+
+                        for (size_t bytesToSkip = 1U; bytesToSkip < std::min<size_t>(length, 5U); bytesToSkip++)
+                        {
+                            std::vector<uint8_t> decoded(length - bytesToSkip);
+                            Base64Decode(Base64StringView(encoded), Base64BufferView(decoded), bytesToSkip);
+
+                            Assert::IsTrue(std::equal(decoded.begin(), decoded.end(), expected.begin() + bytesToSkip));
+                        }
+                    }
+                }
+
                 GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestIsUriBase64)
                 {
                     std::string::const_iterator itBegin;
@@ -327,7 +395,72 @@ namespace Microsoft
 
                     Assert::IsTrue(IsUriBase64("data:image/png;base64,/+==", itBegin, itEnd));
                 }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestBase64BufferCacheEviction)
+                {
+                    Microsoft::glTF::Buffer buffer1;
+                    buffer1.id = "buffer1";
+                    buffer1.uri = "AAECAwQFBgcICQoL";// 12 bytes
+
+                    Microsoft::glTF::Buffer buffer2;
+                    buffer2.id = "buffer2";
+                    buffer2.uri = "////////////////";// 12 bytes
+
+                    // Only one of the buffers fits within the budget
+                    const size_t entryByteCount = Base64BufferCache::GetEntryByteCount(buffer1, 12U);
+
+                    Base64BufferCache cache(entryByteCount * 2U - 1U);
+
+                    auto data1 = cache.Get(buffer1, Base64StringView(buffer1.uri));
+                    Assert::IsTrue(cache.Get(buffer1, Base64StringView(buffer1.uri)) == data1);
+
+                    // Caching the second buffer exceeds the budget so the first buffer is evicted
+                    auto data2 = cache.Get(buffer2, Base64StringView(buffer2.uri));
+
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                    Assert::AreEqual<size_t>(entryByteCount, cache.GetByteCount());
+                    Assert::IsTrue(*data2 == std::vector<uint8_t>(12U, 0xFF));
+
+                    // The evicted data remains valid while referenced
+                    Assert::IsTrue(*data1 == std::vector<uint8_t>{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U });
+                    Assert::IsFalse(cache.Get(buffer1, Base64StringView(buffer1.uri)) == data1);
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestBase64BufferCacheSameIdDifferentUri)
+                {
+                    Base64BufferCache cache(1024U);
+
+                    // Buffers of different documents that share an id and a uri length, with the earlier uri freed
+                    // before the next is created, must not be served each other's data
+                    for (uint8_t i = 0U; i < 8U; ++i)
+                    {
+                        auto buffer = std::make_unique<Microsoft::glTF::Buffer>();
+                        buffer->id = "0";
+                        buffer->uri = Base64Encode(std::vector<uint8_t>(12U, i));
+
+                        auto data = cache.Get(*buffer, Base64StringView(buffer->uri));
+                        Assert::IsTrue(*data == std::vector<uint8_t>(12U, i));
+                    }
+
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestCoalesceByteRanges)
+                {
+                    auto ranges = CoalesceByteRanges({ { 100U, 120U }, { 0U, 10U }, { 10U, 20U }, { 124U, 130U }, { 5U, 8U }, { 60U, 70U } }, 4U);
+
+                    Assert::AreEqual<size_t>(3U, ranges.size());
+                    Assert::AreEqual<size_t>(0U, ranges[0].byteBegin);
+                    Assert::AreEqual<size_t>(20U, ranges[0].byteEnd);
+                    Assert::AreEqual<size_t>(60U, ranges[1].byteBegin);
+                    Assert::AreEqual<size_t>(70U, ranges[1].byteEnd);
+                    Assert::AreEqual<size_t>(100U, ranges[2].byteBegin);
+                    Assert::AreEqual<size_t>(130U, ranges[2].byteEnd);
+
+                    Assert::AreEqual<size_t>(5U, CoalesceByteRanges({ { 0U, 1U }, { 2U, 3U }, { 4U, 5U }, { 6U, 7U }, { 8U, 9U } }, 0U).size());
+                    Assert::AreEqual<size_t>(1U, CoalesceByteRanges({ { 0U, 1U }, { 8U, 9U } }, std::numeric_limits<size_t>::max()).size());
+                }
             };
         }
     }
-}
\ No newline at end of file
+}
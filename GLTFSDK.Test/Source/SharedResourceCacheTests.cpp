@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/SharedResourceCache.h>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    void WriteFile(const std::string& path, const std::string& contents)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(SharedResourceCacheTests)
+            {
+                GLTFSDK_TEST_METHOD(SharedResourceCacheTests, SharedResourceCacheGet)
+                {
+                    const std::string path1 = "SharedResourceCacheTest1.bin";
+                    const std::string path2 = "SharedResourceCacheTest2.bin";
+
+                    WriteFile(path1, "Apple");
+                    WriteFile(path2, "Orange");
+
+                    {
+                        SharedResourceCache cache(12U);
+
+                        auto data1 = cache.Get(path1);
+                        Assert::IsTrue(*data1 == std::vector<uint8_t>{ 'A', 'p', 'p', 'l', 'e' });
+
+                        // Paths that resolve to the same file share the cached data
+                        Assert::IsTrue(cache.Get("./" + path1) == data1);
+
+                        auto data2 = cache.Get(path2);
+
+                        Assert::AreEqual<size_t>(2U, cache.Size());
+                        Assert::AreEqual<size_t>(11U, cache.GetByteCount());
+
+                        // A change to the file's size invalidates the cached data
+                        WriteFile(path1, "Pear");
+
+                        auto data3 = cache.Get(path1);
+                        Assert::IsTrue(*data3 == std::vector<uint8_t>{ 'P', 'e', 'a', 'r' });
+                        Assert::IsTrue(*data1 == std::vector<uint8_t>{ 'A', 'p', 'p', 'l', 'e' });// The old data remains valid
+
+                        // Reducing the budget evicts the least recently used file
+                        cache.SetByteBudget(5U);
+
+                        Assert::AreEqual<size_t>(1U, cache.Size());
+                        Assert::IsTrue(cache.Get(path1) == data3);
+
+                        const auto stats = cache.GetStats();
+
+                        Assert::AreEqual<size_t>(2U, stats.hitCount);
+                        Assert::AreEqual<size_t>(3U, stats.missCount);
+                        Assert::AreEqual<size_t>(1U, stats.evictionCount);
+
+                        Assert::ExpectException<GLTFException>([&cache]()
+                        {
+                            cache.Get("SharedResourceCacheTestMissing.bin");
+                        });
+                    }
+
+                    std::remove(path1.c_str());
+                    std::remove(path2.c_str());
+                }
+
+                GLTFSDK_TEST_METHOD(SharedResourceCacheTests, SharedResourceStreamReaderShared)
+                {
+                    const std::string path = "SharedResourceCacheTest3.bin";
+
+                    const std::vector<float> values = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+                    WriteFile(path, std::string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float)));
+
+                    {
+                        auto cache = std::make_shared<SharedResourceCache>(1024U);
+
+                        Buffer buffer;
+                        buffer.id = "0";
+                        buffer.uri = path;
+                        buffer.byteLength = values.size() * sizeof(float);
+
+                        BufferView bufferView;
+                        bufferView.id = "0";
+                        bufferView.bufferId = "0";
+                        bufferView.byteLength = values.size() * sizeof(float);
+
+                        Document document;
+                        document.buffers.Append(std::move(buffer));
+                        document.bufferViews.Append(std::move(bufferView));
+
+                        // Readers of different documents share one copy of the file, which is only read once
+                        GLTFResourceReader reader1(std::make_shared<SharedResourceStreamReader>("", cache));
+                        GLTFResourceReader reader2(std::make_shared<SharedResourceStreamReader>("", cache));
+
+                        Assert::IsTrue(reader1.ReadBinaryData<float>(document, document.bufferViews.Get("0")) == values);
+                        Assert::IsTrue(reader2.ReadBinaryData<float>(document, document.bufferViews.Get("0")) == values);
+
+                        Assert::AreEqual<size_t>(1U, cache->GetStats().missCount);
+                        Assert::AreEqual<size_t>(1U, cache->GetStats().hitCount);
+                    }
+
+                    std::remove(path.c_str());
+                }
+            };
+        }
+    }
+}
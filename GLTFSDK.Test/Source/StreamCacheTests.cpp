@@ -3,7 +3,14 @@
 
 #include "stdafx.h"
 
+#include <GLTFSDK/StreamCacheByteBudget.h>
+#include <GLTFSDK/StreamCacheConcurrent.h>
 #include <GLTFSDK/StreamCacheLRU.h>
+#include <GLTFSDK/StreamCacheThreadLocal.h>
+
+#include <atomic>
+#include <limits>
+#include <thread>
 
 using namespace glTF::UnitTest;
 
@@ -30,6 +37,15 @@ namespace
 
         mutable std::unordered_map<std::string, size_t> m_counts;
     };
+
+    class TestStreamWriter : public Microsoft::glTF::IStreamWriter
+    {
+    public:
+        std::shared_ptr<std::ostream> GetOutputStream(const std::string&) const override
+        {
+            return std::make_shared<std::stringstream>();
+        }
+    };
 }
 
 namespace Microsoft
@@ -214,6 +230,193 @@ namespace Microsoft
                         Assert::IsTrue(ss1Cached->str().empty());
                     }
                 }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheByteBudget)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheByteBudget>(streamReader, 12U);
+
+                    auto ss1 = std::make_shared<std::stringstream>("Apple");
+                    auto ss2 = std::make_shared<std::stringstream>("Pear");
+                    auto ss3 = std::make_shared<std::stringstream>("Orange");
+
+                    streamCache->Set("1", ss1);
+                    streamCache->Set("2", ss2);
+
+                    Assert::AreEqual(size_t(9), streamCache->GetByteCount());
+                    Assert::IsTrue(streamCache->Get("1") == ss1);// 'Apple' is now the most recently used stream
+
+                    // Adding 'Orange' would exceed the budget so the least recently used stream, 'Pear', is evicted
+                    streamCache->Set("3", ss3);
+
+                    Assert::AreEqual(size_t(2), streamCache->Size());
+                    Assert::AreEqual(size_t(11), streamCache->GetByteCount());
+                    Assert::IsTrue(streamCache->Get("1") == ss1);
+                    Assert::IsTrue(streamCache->Get("2") != ss2);
+
+                    // Streams larger than the budget are returned but never cached
+                    auto ss4 = std::make_shared<std::stringstream>("Watermelons!!");
+                    Assert::IsTrue(streamCache->Set("4", ss4) == ss4);
+                    Assert::IsFalse(streamCache->Get("4") == ss4);
+
+                    const auto& stats = streamCache->GetStats();
+
+                    Assert::AreEqual(size_t(2), stats.hitCount);
+                    Assert::AreEqual(size_t(2), stats.missCount);
+                    Assert::AreEqual(size_t(1), stats.evictionCount);
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheByteBudgetMaxSize)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheByteBudget>(streamReader, 1024U, 2U);
+
+                    // Empty streams hold no bytes so only the max size limits the number of entries
+                    streamCache->Get("1");
+                    streamCache->Get("2");
+                    streamCache->Get("3");
+
+                    Assert::AreEqual(size_t(2), streamCache->Size());
+                    Assert::AreEqual(size_t(0), streamCache->GetByteCount());
+                    Assert::AreEqual(size_t(1), streamCache->GetStats().evictionCount);
+
+                    Assert::ExpectException<GLTFException>([&streamReader]()
+                    {
+                        MakeStreamReaderCache<StreamReaderCacheByteBudget>(streamReader, 0U);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamWriterCacheByteBudget)
+                {
+                    auto streamWriter = std::make_shared<TestStreamWriter>();
+                    auto streamCache = MakeStreamWriterCache<StreamWriterCacheByteBudget>(streamWriter, 100U);
+
+                    // Writer streams are empty when they're added so they're measured again once written to
+                    auto stream1 = streamCache->Get("1");
+                    *stream1 << std::string(60U, 'A');
+
+                    streamCache->UpdateByteCount("1");
+                    Assert::AreEqual(size_t(60), streamCache->GetByteCount());
+
+                    auto stream2 = streamCache->Get("2");
+                    *stream2 << std::string(60U, 'B');
+
+                    // Getting the stream measures it again, so the least recently used stream is evicted
+                    Assert::IsTrue(streamCache->Get("2") == stream2);
+
+                    Assert::AreEqual(size_t(1), streamCache->Size());
+                    Assert::AreEqual(size_t(60), streamCache->GetByteCount());
+                    Assert::AreEqual(size_t(1), streamCache->GetStats().evictionCount);
+
+                    // A stream that grows beyond the budget is no longer cached
+                    *stream2 << std::string(60U, 'B');
+
+                    auto stream3 = streamCache->Get("3");
+
+                    Assert::AreEqual(size_t(1), streamCache->Size());
+                    Assert::AreEqual(size_t(0), streamCache->GetByteCount());
+                    Assert::IsFalse(streamCache->Get("2") == stream2);
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheConcurrentClock)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheConcurrent>(streamReader, 2U, 1U);
+
+                    auto stream1 = streamCache->Get("1");
+                    auto stream2 = streamCache->Get("2");
+
+                    Assert::IsTrue(streamCache->Get("1") == stream1);// Marks '1' as referenced
+
+                    // The hand skips the referenced entry and replaces '2'
+                    streamCache->Get("3");
+
+                    Assert::AreEqual(size_t(2), streamCache->Size());
+                    Assert::IsTrue(streamCache->Get("1") == stream1);
+                    Assert::AreEqual(size_t(1), streamReader->m_counts["1"]);
+
+                    Assert::IsFalse(streamCache->Get("2") == stream2);
+                    Assert::AreEqual(size_t(2), streamReader->m_counts["2"]);
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheConcurrentGet)
+                {
+                    std::atomic<size_t> generateCount(0U);
+
+                    StreamReaderCacheConcurrent streamCache([&generateCount](const std::string&)
+                    {
+                        ++generateCount;
+                        return std::make_shared<std::stringstream>();
+                    }, std::numeric_limits<size_t>::max(), 4U);
+
+                    const size_t threadCount = 4U;
+                    const size_t uriCount = 16U;
+
+                    std::vector<std::vector<std::shared_ptr<std::istream>>> streams(threadCount);
+                    std::vector<std::thread> threads;
+
+                    for (size_t i = 0U; i < threadCount; ++i)
+                    {
+                        threads.emplace_back([&streamCache, &streams, i]()
+                        {
+                            for (size_t j = 0U; j < 100U; ++j)
+                            {
+                                streams[i].push_back(streamCache.Get(std::to_string(j % uriCount)));
+                            }
+                        });
+                    }
+
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    // Threads that race to populate an entry may each generate a stream, but only the first one is cached
+                    // and returned to all of them
+                    Assert::AreEqual(uriCount, streamCache.Size());
+                    Assert::IsTrue(generateCount.load() >= uriCount);
+
+                    for (size_t i = 0U; i < threadCount; ++i)
+                    {
+                        for (size_t j = 0U; j < streams[i].size(); ++j)
+                        {
+                            Assert::IsTrue(streams[i][j] == streamCache.Get(std::to_string(j % uriCount)));
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheThreadLocalGet)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheThreadLocal>(streamReader);
+
+                    auto stream1 = streamCache->Get("1");
+                    auto stream2 = streamCache->Get("1");// Should return the calling thread's cached stream
+
+                    Assert::IsTrue(stream1 == stream2);
+                    Assert::AreEqual(size_t(1), streamReader->m_counts["1"]);
+
+                    std::shared_ptr<std::istream> stream3;
+
+                    std::thread thread([&]()
+                    {
+                        stream3 = streamCache->Get("1");// Should populate a separate cache for this thread
+                    });
+
+                    thread.join();
+
+                    Assert::IsTrue(stream1 != stream3);
+                    Assert::AreEqual(size_t(2), streamReader->m_counts["1"]);
+                    Assert::AreEqual(size_t(2), streamCache->GetThreadCount());
+
+                    // Releasing a thread's cache discards its streams, the next Get populates a new cache
+                    streamCache->ReleaseThreadCache();
+
+                    Assert::AreEqual(size_t(1), streamCache->GetThreadCount());
+                    Assert::IsTrue(streamCache->Get("1") != stream1);
+                    Assert::AreEqual(size_t(3), streamReader->m_counts["1"]);
+                    Assert::AreEqual(size_t(16), streamCache->cacheMaxSize);
+                }
             };
         }
     }
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/AccessorView.h>
+#include <GLTFSDK/GLTF.h>
+
+#include <memory>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // The decoded, tightly packed data of an accessor whose component type is only known at runtime (e.g. the
+        // result of GLTFResourceReader::ReadBinaryDataBatch). Use GetView or ToVector to access the typed components.
+        class AccessorData
+        {
+        public:
+            AccessorData()
+                : m_count(0U),
+                m_type(TYPE_UNKNOWN),
+                m_componentType(COMPONENT_UNKNOWN)
+            {
+            }
+
+            AccessorData(std::shared_ptr<const uint8_t> data, size_t count, AccessorType type, ComponentType componentType)
+                : m_data(std::move(data)),
+                m_count(count),
+                m_type(type),
+                m_componentType(componentType)
+            {
+            }
+
+            template<typename T>
+            AccessorData(std::vector<T> data, AccessorType type, ComponentType componentType)
+                : AccessorData(MakeShared(std::move(data)), type, componentType)
+            {
+                ValidateComponentType<T>(componentType);
+            }
+
+            // The number of elements (e.g. VEC3s)
+            size_t GetCount() const
+            {
+                return m_count;
+            }
+
+            AccessorType GetType() const
+            {
+                return m_type;
+            }
+
+            ComponentType GetComponentType() const
+            {
+                return m_componentType;
+            }
+
+            bool IsEmpty() const
+            {
+                return m_count == 0U;
+            }
+
+            size_t GetByteLength() const
+            {
+                return m_count == 0U ? 0U : m_count * Accessor::GetComponentTypeSize(m_componentType) * Accessor::GetTypeCount(m_type);
+            }
+
+            const uint8_t* Data() const
+            {
+                return m_data.get();
+            }
+
+            // Returns a view of the data, T must match the accessor's component type
+            template<typename T>
+            AccessorView<T> GetView() const
+            {
+                ValidateComponentType<T>(m_componentType);
+
+                const size_t typeCount = Accessor::GetTypeCount(m_type);
+
+                return AccessorView<T>(std::shared_ptr<const T>(m_data, reinterpret_cast<const T*>(m_data.get())), m_count, typeCount, sizeof(T) * typeCount, m_componentType);
+            }
+
+            template<typename T>
+            std::vector<T> ToVector() const
+            {
+                return GetView<T>().ToVector();
+            }
+
+        private:
+            template<typename T>
+            AccessorData(std::shared_ptr<const std::vector<T>> data, AccessorType type, ComponentType componentType)
+                : AccessorData(std::shared_ptr<const uint8_t>(data, reinterpret_cast<const uint8_t*>(data->data())), data->size() / Accessor::GetTypeCount(type), type, componentType)
+            {
+            }
+
+            template<typename T>
+            static std::shared_ptr<const std::vector<T>> MakeShared(std::vector<T> data)
+            {
+                return std::make_shared<const std::vector<T>>(std::move(data));
+            }
+
+            std::shared_ptr<const uint8_t> m_data;
+
+            size_t m_count;
+
+            AccessorType m_type;
+            ComponentType m_componentType;
+        };
+    }
+}
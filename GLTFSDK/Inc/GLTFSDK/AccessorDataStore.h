@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/AccessorData.h>
+#include <GLTFSDK/ByteBudgetCache.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+
+#include <future>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        typedef CacheStats AccessorDataStoreStats;
+
+        // A memoized store of decoded accessor data for one document, so that several stages of a pipeline (e.g.
+        // validation, bounds, tangent generation and export) share the data rather than each reading it again. An
+        // accessor is decoded on first access and the least recently used accessors are evicted when the total decoded
+        // size would exceed the byte budget. Accessors larger than the budget are decoded but never stored.
+        //
+        // Note: the document and the reader must outlive the store and the document must not be modified while the
+        // store is in use. All member functions are thread-safe and an accessor requested by several threads at once is
+        // only decoded once, the other threads wait for its data. Unless calls are made from one thread at a time the
+        // reader must be set up for concurrent use (see GLTFResourceReader). Evicted data stays alive while any
+        // references remain.
+        class AccessorDataStore
+        {
+        public:
+            AccessorDataStore(const Document& document, const GLTFResourceReader& reader, size_t byteBudget = std::numeric_limits<size_t>::max());
+
+            AccessorDataStore(const AccessorDataStore&) = delete;
+            AccessorDataStore& operator=(const AccessorDataStore&) = delete;
+
+            // Returns the accessor's decoded data, decoding and storing it if necessary
+            AccessorData Get(const std::string& accessorId);
+
+            AccessorData Get(const Accessor& accessor)
+            {
+                return Get(accessor.id);
+            }
+
+            template<typename T>
+            std::vector<T> GetVector(const std::string& accessorId)
+            {
+                return Get(accessorId).ToVector<T>();
+            }
+
+            // Decodes any of the accessors that aren't already stored with a single ReadBinaryDataBatch call, so that
+            // their byte ranges are coalesced and decoded on up to threadCount threads (0 uses one thread per hardware
+            // thread)
+            void Prefetch(const std::vector<std::string>& accessorIds, size_t threadCount = 0U);
+
+            // Evicts the least recently used accessors if the stored data exceeds the new budget
+            void SetByteBudget(size_t byteBudget);
+            size_t GetByteBudget() const;
+
+            // The total decoded size of the accessors currently held by the store
+            size_t GetByteCount() const;
+
+            AccessorDataStoreStats GetStats() const;
+
+            bool Contains(const std::string& accessorId) const;
+            void Erase(const std::string& accessorId);
+
+            size_t Size() const;
+            void Clear();
+
+            const Document& GetDocument() const
+            {
+                return m_document;
+            }
+
+            const GLTFResourceReader& GetReader() const
+            {
+                return m_reader;
+            }
+
+        private:
+            const Document& m_document;
+            const GLTFResourceReader& m_reader;
+
+            ByteBudgetCache<AccessorData> m_cache;
+
+            // Accessors that are currently being decoded by another call
+            std::unordered_map<std::string, std::shared_future<AccessorData>> m_pending;
+
+            mutable std::mutex m_mutex;
+        };
+    }
+}
@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Throws if T isn't the component data type that corresponds to the specified accessor ComponentType
+        template<typename T>
+        void ValidateComponentType(ComponentType componentType)
+        {
+            bool isValid;
+
+            switch (componentType)
+            {
+            case COMPONENT_BYTE:
+                isValid = std::is_same<T, int8_t>::value;
+                break;
+            case COMPONENT_UNSIGNED_BYTE:
+                isValid = std::is_same<T, uint8_t>::value;
+                break;
+            case COMPONENT_SHORT:
+                isValid = std::is_same<T, int16_t>::value;
+                break;
+            case COMPONENT_UNSIGNED_SHORT:
+                isValid = std::is_same<T, uint16_t>::value;
+                break;
+            case COMPONENT_UNSIGNED_INT:
+                isValid = std::is_same<T, uint32_t>::value;
+                break;
+            case COMPONENT_FLOAT:
+                isValid = std::is_same<T, float>::value;
+                break;
+            default:
+                throw GLTFException("Unsupported accessor ComponentType");
+            }
+
+            if (!isValid)
+            {
+                throw GLTFException("ReadAccessorData: Template type T does not match accessor ComponentType");
+            }
+        }
+
+        // A read-only strided view of accessor data. The view either points directly into memory owned by a reader
+        // (e.g. a GLB BIN chunk) or owns a tightly packed copy of the data when a direct view isn't possible.
+        template<typename T>
+        class AccessorView
+        {
+        public:
+            AccessorView()
+                : m_count(0U),
+                m_typeCount(0U),
+                m_byteStride(0U),
+                m_componentType(COMPONENT_UNKNOWN)
+            {
+            }
+
+            AccessorView(std::shared_ptr<const T> data, size_t count, size_t typeCount, size_t byteStride, ComponentType componentType)
+                : m_data(std::move(data)),
+                m_count(count),
+                m_typeCount(typeCount),
+                m_byteStride(byteStride),
+                m_componentType(componentType)
+            {
+            }
+
+            AccessorView(std::vector<T> data, size_t typeCount, ComponentType componentType)
+                : AccessorView(MakeShared(std::move(data)), typeCount, componentType)
+            {
+            }
+
+            // The number of elements (e.g. VEC3s) in the view
+            size_t GetCount() const
+            {
+                return m_count;
+            }
+
+            // The number of components (e.g. 3 for a VEC3) in each element
+            size_t GetTypeCount() const
+            {
+                return m_typeCount;
+            }
+
+            // The number of bytes between the start of consecutive elements
+            size_t GetByteStride() const
+            {
+                return m_byteStride;
+            }
+
+            ComponentType GetComponentType() const
+            {
+                return m_componentType;
+            }
+
+            bool IsEmpty() const
+            {
+                return m_count == 0U;
+            }
+
+            // True when the elements are tightly packed, i.e. Data() can be treated as an array of GetCount() * GetTypeCount() components
+            bool IsContiguous() const
+            {
+                return m_byteStride == sizeof(T) * m_typeCount;
+            }
+
+            const T* Data() const
+            {
+                return m_data.get();
+            }
+
+            const T* GetElement(size_t index) const
+            {
+                return reinterpret_cast<const T*>(reinterpret_cast<const uint8_t*>(m_data.get()) + index * m_byteStride);
+            }
+
+            const T& Get(size_t index, size_t component) const
+            {
+                return GetElement(index)[component];
+            }
+
+            const T* operator[](size_t index) const
+            {
+                return GetElement(index);
+            }
+
+            std::vector<T> ToVector() const
+            {
+                std::vector<T> result;
+
+                if (IsContiguous())
+                {
+                    result.assign(Data(), Data() + m_count * m_typeCount);
+                }
+                else
+                {
+                    result.reserve(m_count * m_typeCount);
+
+                    for (size_t i = 0U; i < m_count; i++)
+                    {
+                        auto element = GetElement(i);
+                        result.insert(result.end(), element, element + m_typeCount);
+                    }
+                }
+
+                return result;
+            }
+
+        private:
+            AccessorView(std::shared_ptr<const std::vector<T>> data, size_t typeCount, ComponentType componentType)
+                : AccessorView(std::shared_ptr<const T>(data, data->data()), typeCount ? data->size() / typeCount : 0U, typeCount, sizeof(T) * typeCount, componentType)
+            {
+            }
+
+            static std::shared_ptr<const std::vector<T>> MakeShared(std::vector<T> data)
+            {
+                return std::make_shared<const std::vector<T>>(std::move(data));
+            }
+
+            std::shared_ptr<const T> m_data;
+
+            size_t m_count;
+            size_t m_typeCount;
+            size_t m_byteStride;
+
+            ComponentType m_componentType;
+        };
+    }
+}
@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ByteBudgetCache.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/ResourceReaderUtils.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Caches the decoded contents of base64 data uri buffers, keyed by buffer id. When adding a buffer would exceed
+        // the byte budget the least recently used buffers are evicted. Buffers larger than the budget are never cached.
+        //
+        // Note: an entry is only reused for the same Buffer object with the same uri storage and length, and a
+        // fingerprint of a fixed number of the uri's characters, all taken when the entry is added. A lookup is therefore
+        // constant time however long the uri is. A buffer from another document that reuses the memory of a freed one is
+        // told apart by its fingerprint, but a uri that is modified in place while its buffer is cached is not detected
+        // and Clear must be called afterwards. The buffer id and identity of each entry are counted against the byte
+        // budget. Evicted data stays alive while any references remain. All member functions are thread-safe, a lookup
+        // takes a short lock and the lock isn't held while a buffer is being decoded.
+        class Base64BufferCache
+        {
+        public:
+            explicit Base64BufferCache(size_t byteBudget) :
+                m_cache(byteBudget, [](const CachedBuffer& cachedBuffer) { return cachedBuffer.byteCount; })
+            {
+            }
+
+            // Returns the decoded buffer data, decoding and caching it if necessary. Returns nullptr if the buffer's
+            // entry would exceed the byte budget.
+            std::shared_ptr<const std::vector<uint8_t>> Get(const Buffer& buffer, Base64StringView encodedData)
+            {
+                const BufferIdentity identity = GetBufferIdentity(buffer);
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    if (auto data = Find(buffer.id, identity))
+                    {
+                        return data;
+                    }
+                }
+
+                const size_t byteCount = GetEntryByteCount(buffer, encodedData.GetByteCount());
+
+                if (byteCount > m_cache.GetByteBudget())
+                {
+                    return nullptr;
+                }
+
+                auto data = std::make_shared<const std::vector<uint8_t>>(Base64Decode(encodedData));
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                // Another thread may have cached the same buffer while it was being decoded
+                if (auto cachedData = Find(buffer.id, identity))
+                {
+                    return cachedData;
+                }
+
+                m_cache.Insert(buffer.id, { identity, data, byteCount });
+
+                return data;
+            }
+
+            void Clear()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_cache.Clear();
+            }
+
+            size_t GetByteBudget() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_cache.GetByteBudget();
+            }
+
+            // The total size of the cached entries, i.e. their decoded data, buffer ids and identities
+            size_t GetByteCount() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_cache.GetByteCount();
+            }
+
+            size_t Size() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_cache.Size();
+            }
+
+            // The number of bytes counted against the budget for a buffer whose decoded size is byteLength
+            static size_t GetEntryByteCount(const Buffer& buffer, size_t byteLength)
+            {
+                return byteLength + buffer.id.size() + sizeof(BufferIdentity);
+            }
+
+        private:
+            struct BufferIdentity
+            {
+                const Buffer* buffer;
+                const char* uriData;
+                size_t uriLength;
+                uint64_t uriFingerprint;
+
+                bool operator==(const BufferIdentity& other) const
+                {
+                    return buffer == other.buffer
+                        && uriData == other.uriData
+                        && uriLength == other.uriLength
+                        && uriFingerprint == other.uriFingerprint;
+                }
+
+                bool operator!=(const BufferIdentity& other) const
+                {
+                    return !(*this == other);
+                }
+            };
+
+            struct CachedBuffer
+            {
+                BufferIdentity identity;
+                std::shared_ptr<const std::vector<uint8_t>> data;
+                size_t byteCount;
+            };
+
+            // Hashes (FNV-1a) at most FingerprintSampleCount evenly spaced characters of the uri, including its last
+            static BufferIdentity GetBufferIdentity(const Buffer& buffer)
+            {
+                const std::string& uri = buffer.uri;
+                const size_t step = uri.size() / FingerprintSampleCount + 1U;
+
+                uint64_t fingerprint = 14695981039346656037ULL;
+
+                for (size_t i = (uri.size() + step - 1U) % step; i < uri.size(); i += step)
+                {
+                    fingerprint = (fingerprint ^ static_cast<uint8_t>(uri[i])) * 1099511628211ULL;
+                }
+
+                return { &buffer, uri.data(), uri.size(), fingerprint };
+            }
+
+            // Returns the buffer's cached data, if any, and makes it the 'most recently used' entry. Must be called with m_mutex held.
+            std::shared_ptr<const std::vector<uint8_t>> Find(const std::string& bufferId, const BufferIdentity& identity)
+            {
+                auto cachedBuffer = m_cache.Find(bufferId);
+
+                if (!cachedBuffer)
+                {
+                    return nullptr;
+                }
+
+                // The buffer id refers to different data (e.g. a buffer from another document) so discard the stale entry
+                if (cachedBuffer->identity != identity)
+                {
+                    m_cache.Erase(bufferId);
+                    return nullptr;
+                }
+
+                return cachedBuffer->data;
+            }
+
+            static constexpr size_t FingerprintSampleCount = 64U;
+
+            ByteBudgetCache<CachedBuffer> m_cache;
+
+            mutable std::mutex m_mutex;
+        };
+    }
+}
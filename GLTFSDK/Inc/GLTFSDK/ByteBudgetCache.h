@@ -0,0 +1,224 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        struct CacheStats
+        {
+            size_t hitCount;
+            size_t missCount;
+            size_t evictionCount;
+        };
+
+        // A 'Least Recently Used' (LRU) map from string keys to values that evicts entries to keep the total size of its
+        // values within a byte budget, and optionally the number of entries within a maximum. The size of each value is
+        // measured by the byte count functor when it's inserted and again by UpdateByteCount. A value larger than the
+        // budget is never stored.
+        //
+        // Note: this class is not thread-safe, the caches built on it (e.g. AccessorDataStore and SharedResourceCache)
+        // provide their own locking where required. Evictions are counted here, hits and misses are recorded by the owner as only it knows what
+        // counts as a lookup.
+        template<typename TValue>
+        class ByteBudgetCache
+        {
+        public:
+            typedef std::function<size_t(const TValue&)> ByteCountFn;
+
+            ByteBudgetCache(size_t byteBudget, ByteCountFn fnByteCount, size_t maxSize = std::numeric_limits<size_t>::max()) :
+                m_byteBudget(byteBudget),
+                m_maxSize(maxSize),
+                m_byteCount(0U),
+                m_stats({ 0U, 0U, 0U }),
+                m_byteCountFn(std::move(fnByteCount))
+            {
+            }
+
+            // Returns the key's value and makes it the 'most recently used' entry, or nullptr if the key isn't stored
+            TValue* Find(const std::string& key)
+            {
+                auto it = m_cacheMap.find(key);
+
+                if (it == m_cacheMap.end())
+                {
+                    return nullptr;
+                }
+
+                if (it->second != m_cacheList.begin())
+                {
+                    m_cacheList.splice(m_cacheList.begin(), m_cacheList, it->second);
+                }
+
+                return &it->second->value;
+            }
+
+            bool Contains(const std::string& key) const
+            {
+                return m_cacheMap.find(key) != m_cacheMap.end();
+            }
+
+            // Stores the value as the 'most recently used' entry, replacing any value with the same key and evicting the
+            // least recently used entries until it fits. Returns false, and stores nothing, if the value alone exceeds the
+            // budget.
+            bool Insert(const std::string& key, TValue value)
+            {
+                Erase(key);
+
+                const size_t byteCount = m_byteCountFn(value);
+
+                if (byteCount > m_byteBudget)
+                {
+                    return false;
+                }
+
+                Evict(byteCount, 1U);
+
+                m_cacheList.push_front({ key, std::move(value), byteCount });
+                m_cacheMap[key] = m_cacheList.begin();
+                m_byteCount += byteCount;
+
+                return true;
+            }
+
+            void Erase(const std::string& key)
+            {
+                auto it = m_cacheMap.find(key);
+
+                if (it != m_cacheMap.end())
+                {
+                    Erase(it);
+                }
+            }
+
+            // Measures the key's value again, e.g. once a stream has been written to, and evicts entries if the cache now
+            // exceeds the budget. The value itself is evicted if it alone exceeds the budget.
+            void UpdateByteCount(const std::string& key)
+            {
+                auto it = m_cacheMap.find(key);
+
+                if (it != m_cacheMap.end())
+                {
+                    Measure(*it->second);
+
+                    if (it->second->byteCount > m_byteBudget)
+                    {
+                        Erase(it);
+                        ++m_stats.evictionCount;
+                    }
+
+                    Evict(0U, 0U);
+                }
+            }
+
+            // Measures every value again, then evicts entries if the cache now exceeds the budget
+            void UpdateByteCounts()
+            {
+                for (auto& entry : m_cacheList)
+                {
+                    Measure(entry);
+                }
+
+                Evict(0U, 0U);
+            }
+
+            // Evicts the least recently used entries if the stored values exceed the new budget
+            void SetByteBudget(size_t byteBudget)
+            {
+                m_byteBudget = byteBudget;
+                Evict(0U, 0U);
+            }
+
+            size_t GetByteBudget() const
+            {
+                return m_byteBudget;
+            }
+
+            // The total size of the stored values when they were last measured
+            size_t GetByteCount() const
+            {
+                return m_byteCount;
+            }
+
+            size_t Size() const
+            {
+                return m_cacheMap.size();
+            }
+
+            void Clear()
+            {
+                m_cacheMap.clear();
+                m_cacheList.clear();
+                m_byteCount = 0U;
+            }
+
+            const CacheStats& GetStats() const
+            {
+                return m_stats;
+            }
+
+            void RecordHit()
+            {
+                ++m_stats.hitCount;
+            }
+
+            void RecordMiss(size_t count = 1U)
+            {
+                m_stats.missCount += count;
+            }
+
+        private:
+            struct Entry
+            {
+                std::string key;
+                TValue value;
+                size_t byteCount;
+            };
+
+            typedef std::list<Entry> CacheList;
+            typedef std::unordered_map<std::string, typename CacheList::iterator> CacheMap;
+
+            void Measure(Entry& entry)
+            {
+                m_byteCount -= entry.byteCount;
+                entry.byteCount = m_byteCountFn(entry.value);
+                m_byteCount += entry.byteCount;
+            }
+
+            // Evicts the least recently used entries until byteCount more bytes and entryCount more entries fit
+            void Evict(size_t byteCount, size_t entryCount)
+            {
+                while (!m_cacheList.empty() && (m_byteCount + byteCount > m_byteBudget || m_cacheMap.size() + entryCount > m_maxSize))
+                {
+                    Erase(m_cacheMap.find(m_cacheList.back().key));
+                    ++m_stats.evictionCount;
+                }
+            }
+
+            void Erase(typename CacheMap::iterator it)
+            {
+                m_byteCount -= it->second->byteCount;
+                m_cacheList.erase(it->second);
+                m_cacheMap.erase(it);
+            }
+
+            size_t m_byteBudget;
+            const size_t m_maxSize;
+            size_t m_byteCount;
+            CacheStats m_stats;
+
+            CacheList m_cacheList;
+            CacheMap m_cacheMap;
+
+            ByteCountFn m_byteCountFn;
+        };
+    }
+}
@@ -11,10 +11,14 @@ namespace Microsoft
     namespace glTF
     {
         // IgnoreByteOrderMark -> According to the spec, "JSON must use UTF-8 encoding without BOM". Specifying this flag will ignore the presence of a byte order mark rather than treating it as an error.
+        // Streaming -> Builds the Document directly from the JSON parser's events rather than first parsing the whole JSON into a DOM, so peak memory holds one copy of the scene rather than two. Only a single element of each top-level array (e.g. one node) is held as JSON at a time. As with the default mode the whole JSON is validated against the schema before any of it is parsed, so the JSON is read twice and a std::istream must be seekable. Combine with ValidateWhileParsing to read the JSON once.
+        // ValidateWhileParsing -> Validates the JSON against the schema while it's parsed into a DOM, rather than parsing it and then walking the whole DOM a second time to validate it. With the Streaming mode the JSON is validated while the Document is built from the parser's events instead, so it's read once and the stream needn't be seekable. Schema violations are reported with the same ValidationException messages.
         enum class DeserializeFlags
         {
             None = 0x0,
-            IgnoreByteOrderMark = 0x1
+            IgnoreByteOrderMark = 0x1,
+            Streaming = 0x2,
+            ValidateWhileParsing = 0x4
         };
 
         DeserializeFlags  operator| (DeserializeFlags lhs,  DeserializeFlags rhs);
@@ -22,12 +26,26 @@ namespace Microsoft
         DeserializeFlags  operator& (DeserializeFlags lhs,  DeserializeFlags rhs);
         DeserializeFlags& operator&=(DeserializeFlags& lhs, DeserializeFlags rhs);
 
+        class CompiledSchema;
         class ExtensionDeserializer;
+        class IExecutor;
 
         Document Deserialize(const std::string& json, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
         Document Deserialize(const std::string& json, const ExtensionDeserializer& extensions, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
 
         Document Deserialize(std::istream& jsonStream, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
         Document Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensions, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+
+        // The overloads above validate against the glTF schema from SchemaCache::GetProcessCache(), compiling it on first
+        // use for each SchemaFlags. These overloads validate against a schema compiled by the caller instead.
+        Document Deserialize(const std::string& json, const ExtensionDeserializer& extensions, const CompiledSchema& schema, DeserializeFlags flags = DeserializeFlags::None);
+        Document Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensions, const CompiledSchema& schema, DeserializeFlags flags = DeserializeFlags::None);
+
+        // Parses the elements of the top-level arrays (nodes, meshes, accessors etc.) as parallel tasks on the executor.
+        // The result, including which error is reported for an invalid document, is identical to the serial parse. The
+        // extension handlers registered with the ExtensionDeserializer may be called concurrently. The Streaming mode
+        // ignores the executor and parses serially.
+        Document Deserialize(const std::string& json, const ExtensionDeserializer& extensions, const CompiledSchema& schema, IExecutor& executor, DeserializeFlags flags = DeserializeFlags::None);
+        Document Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensions, const CompiledSchema& schema, IExecutor& executor, DeserializeFlags flags = DeserializeFlags::None);
     }
 }
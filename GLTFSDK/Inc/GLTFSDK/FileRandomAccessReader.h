@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/IRandomAccessReader.h>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // An IRandomAccessReader that reads files with positional reads (pread, or ReadFile with an explicit offset on
+        // Windows). Uris are resolved relative to baseDirectory. Files are opened on first use and stay open for the
+        // reader's lifetime. Looking up an open file's handle only takes a shared lock and files are opened without holding
+        // any lock, so the reads themselves run concurrently.
+        class FileRandomAccessReader : public IRandomAccessReader
+        {
+        public:
+            explicit FileRandomAccessReader(std::string baseDirectory = {});
+
+            void ReadAt(const std::string& uri, size_t offset, size_t byteCount, void* data) const override;
+            size_t Size(const std::string& uri) const override;
+
+        private:
+            class File;
+
+            std::shared_ptr<const File> GetFile(const std::string& uri) const;
+
+            std::string m_baseDirectory;
+
+            mutable std::shared_timed_mutex m_filesMutex;
+            mutable std::unordered_map<std::string, std::shared_ptr<const File>> m_files;
+        };
+    }
+}
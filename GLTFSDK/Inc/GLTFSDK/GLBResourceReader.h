@@ -4,29 +4,97 @@
 #pragma once
 
 #include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include <functional>
+#include <mutex>
 
 namespace Microsoft
 {
     namespace glTF
     {
+        // The layout of a GLB, as described by its header and chunk headers. Offsets are relative to the start of the GLB
+        // and refer to the chunks' data, after their headers.
+        struct GLBHeader
+        {
+            uint32_t version;
+            size_t byteLength;
+
+            size_t jsonChunkOffset;
+            size_t jsonChunkLength;
+
+            // Both zero when the GLB has no BIN chunk
+            size_t binChunkOffset;
+            size_t binChunkLength;
+
+            bool HasBinChunk() const
+            {
+                return binChunkOffset != 0U;
+            }
+        };
+
+        // Reads and validates a GLB's header and chunk headers without reading the chunks themselves, at most 28 bytes
+        // are read. The GLB must start at the beginning of the stream. Throws InvalidGLTFException if the GLB is malformed.
+        GLBHeader ReadGLBHeader(std::istream& glbStream);
+        GLBHeader ReadGLBHeader(const IRandomAccessReader& randomAccessReader, const std::string& glbUri);
+        GLBHeader ReadGLBHeader(const uint8_t* glbData, size_t byteLength);
+
+        // Returns a stream over just the GLB's JSON chunk, so the JSON can be passed to Deserialize without first being
+        // copied into a std::string. The chunk of a MemoryStream is referenced directly, other streams are read through a
+        // small buffer as the JSON is parsed. The returned stream shares glbStream and its read position.
+        std::shared_ptr<std::istream> GetGLBJsonStream(std::shared_ptr<std::istream> glbStream, const GLBHeader& header);
+
         class GLBResourceReader : public GLTFResourceReader
         {
         public:
+            // Reads byteCount bytes of the GLB, starting at offset, into data
+            typedef std::function<void(size_t offset, size_t byteCount, void* data)> ReadAtFn;
+
             GLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::shared_ptr<std::istream> glbStream);
             GLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<std::istream> glbStream);
 
+            // Reads the GLB (and any external resources) with positional reads. The GLB's JSON chunk is read when the
+            // reader is constructed, the BIN chunk is only read as accessors, buffer views and images are requested.
+            GLBResourceReader(std::shared_ptr<const IRandomAccessReader> randomAccessReader, std::string glbUri);
+
             std::shared_ptr<std::istream> GetBinaryStream(const Buffer& buffer) const override;
             std::streampos                GetBinaryStreamPos(const Buffer& buffer) const override;
 
             const std::string& GetJson() const;
 
+        protected:
+            std::shared_ptr<const uint8_t> GetBinaryMemory(const Buffer& buffer, size_t& byteCount) const override;
+
+            void ReadBinaryStream(const Buffer& buffer, std::streamoff offset, void* data, size_t byteCount) const override;
+
         private:
             void Init();
+            void InitFromMemory(const MemoryStream& memoryStream);
+            size_t InitFromRandomAccess(const ReadAtFn& readAt, size_t byteLength);
 
             std::string m_json;
 
             std::shared_ptr<std::istream> m_buffer;
             std::streamoff                m_bufferOffset;
+
+            // Set when the GLB is read via an IRandomAccessReader rather than m_buffer
+            std::string                   m_bufferUri;
+
+            // Serializes reads of the BIN chunk when the GLB stream is shared by concurrent readers
+            std::unique_ptr<std::mutex>   m_bufferMutex;
+
+            // Set when the GLB stream is a MemoryStream, pointing at the start of the BIN chunk's data
+            std::shared_ptr<const uint8_t> m_bufferMemory;
+            size_t                         m_bufferMemoryByteLength;
+        };
+
+        // A GLBResourceReader that memory maps the specified GLB file rather than reading it through std::istream calls.
+        // The JSON chunk is parsed directly from the mapping and accessor reads of the BIN chunk access it via pointers.
+        class GLBMappedResourceReader : public GLBResourceReader
+        {
+        public:
+            GLBMappedResourceReader(std::shared_ptr<const IStreamReader> streamReader, const std::string& glbPath);
+            GLBMappedResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, const std::string& glbPath);
         };
     }
 }
@@ -3,19 +3,47 @@
 
 #pragma once
 
+#include <GLTFSDK/AccessorData.h>
+#include <GLTFSDK/AccessorView.h>
+#include <GLTFSDK/Base64BufferCache.h>
 #include <GLTFSDK/Document.h>
+#include <GLTFSDK/IExecutor.h>
+#include <GLTFSDK/IRandomAccessReader.h>
 #include <GLTFSDK/IStreamReader.h>
+#include <GLTFSDK/MemoryStream.h>
 #include <GLTFSDK/ResourceReaderUtils.h>
+#include <GLTFSDK/SparseAccessorView.h>
 #include <GLTFSDK/StreamCacheLRU.h>
 #include <GLTFSDK/StreamUtils.h>
 #include <GLTFSDK/Validation.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <future>
+#include <unordered_map>
 
 namespace Microsoft
 {
     namespace glTF
     {
+        // Reads the binary data of accessors, buffer views and images.
+        //
+        // Concurrent use: a reader constructed with an IRandomAccessReader, or with a StreamReaderCacheThreadLocal (and an
+        // IStreamReader whose GetInputStream is thread-safe), may be used by several threads at once, e.g. to decode different accessors of
+        // the same document. Reads of the data itself run concurrently, only these paths take a lock:
+        //  - a GLB's BIN chunk read from a stream other than a MemoryStream is serialized, as the GLB stream is shared
+        //  - a base64 buffer read with the base64 cache enabled takes the cache's lock to look it up, and to add it once
+        //    decoded, but not while decoding it
+        //  - StreamReaderCacheThreadLocal takes a lock when a thread first uses it or switches between instances, the
+        //    streams themselves are per thread
+        //  - FileRandomAccessReader takes a shared lock to look up an open file and briefly locks it exclusively to
+        //    add a newly opened one
+        // MemoryStreams and mapped GLBs are read without locks. Any locks taken by the supplied IStreamReader (e.g. a
+        // SharedResourceStreamReader when a stream is created) apply as well. The base64 cache must be enabled or
+        // disabled before any concurrent reads begin.
         class GLTFResourceReader
         {
         public:
@@ -25,7 +53,16 @@ namespace Microsoft
             }
 
             GLTFResourceReader(std::unique_ptr<IStreamReaderCache> streamCache)
-                : m_streamReaderCache(std::move(streamCache))
+                : m_streamReaderCache(std::move(streamCache)),
+                m_maxReadGapByteLength(DefaultMaxReadGapByteLength)
+            {
+            }
+
+            // Reads all external resources with positional reads rather than via std::istream. IRandomAccessReader
+            // implementations are thread-safe, so a reader constructed this way can always be used concurrently.
+            GLTFResourceReader(std::shared_ptr<const IRandomAccessReader> randomAccessReader)
+                : m_randomAccessReader(std::move(randomAccessReader)),
+                m_maxReadGapByteLength(DefaultMaxReadGapByteLength)
             {
             }
 
@@ -33,6 +70,38 @@ namespace Microsoft
 
             virtual ~GLTFResourceReader() = default;
 
+            // Enables caching of decoded base64 data uri buffers. Each base64 buffer is decoded in full when first read and
+            // subsequent accessor, buffer view and image reads are served from the decoded data. The least recently used
+            // buffers are evicted when the total decoded size would exceed byteBudget.
+            void EnableBase64Cache(size_t byteBudget)
+            {
+                m_base64Cache = std::make_unique<Base64BufferCache>(byteBudget);
+            }
+
+            void DisableBase64Cache()
+            {
+                m_base64Cache.reset();
+            }
+
+            static constexpr size_t DefaultMaxReadGapByteLength = 64U * 1024U;
+
+            // Sets the largest gap between the byte ranges of accessors in the same external buffer that ReadBinaryDataBatch
+            // reads through (discarding the unused bytes) rather than issuing a separate read for each side of the gap
+            void SetMaxReadGap(size_t maxGapByteLength)
+            {
+                m_maxReadGapByteLength = maxGapByteLength;
+            }
+
+            size_t GetMaxReadGap() const
+            {
+                return m_maxReadGapByteLength;
+            }
+
+            const Base64BufferCache* GetBase64Cache() const
+            {
+                return m_base64Cache.get();
+            }
+
             // TODO: return mimeType of image
             std::vector<uint8_t> ReadBinaryData(const Document& document, const Image& image) const
             {
@@ -54,6 +123,11 @@ namespace Microsoft
                 {
                     data = ReadBinaryDataUri<uint8_t>({ itBegin, itEnd });
                 }
+                else if (m_randomAccessReader)
+                {
+                    data.resize(m_randomAccessReader->Size(image.uri));
+                    m_randomAccessReader->ReadAt(image.uri, 0U, data.size(), data.data());
+                }
                 else if (auto stream = m_streamReaderCache->Get(image.uri))
                 {
                     data = StreamUtils::ReadBinaryFull<uint8_t>(*stream);
@@ -66,72 +140,321 @@ namespace Microsoft
                 return data;
             }
 
+            // Returns an image's encoded data without copying it when the data is already resident in memory, e.g. an image
+            // in a buffer view of a MemoryStream backed (or mapped) GLB, or an external image read via a MemoryStream.
+            // Returns nullptr if the data would have to be read, otherwise byteLength is set to the image's size.
+            std::shared_ptr<const uint8_t> ReadBinaryDataView(const Document& document, const Image& image, size_t& byteLength) const;
+
+            typedef std::function<void(const uint8_t* data, size_t byteCount)> ChunkCallback;
+
+            // Passes an image's encoded data to the callback in order, in chunks of at most chunkByteLength bytes, so that
+            // e.g. a decoder can consume it without the whole image being held in memory. Resident data is passed
+            // directly, otherwise each chunk is read into the same chunkByteLength buffer. Returns the image's size.
+            size_t ReadBinaryDataChunked(const Document& document, const Image& image, const ChunkCallback& callback, size_t chunkByteLength = 64U * 1024U) const;
+
             template<typename T>
             std::vector<T> ReadBinaryData(const Document& gltfDocument, const Accessor& accessor) const
             {
-                bool isValid;
+                ValidateComponentType<T>(accessor.componentType);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
 
-                switch (accessor.componentType)
+                if (accessor.sparse.count > 0U)
+                {
+                    return ReadSparseAccessor<T>(gltfDocument, accessor);
+                }
+
+                return ReadAccessor<T>(gltfDocument, accessor);
+            }
+
+            template<typename T>
+            std::vector<T> ReadBinaryData(const Document& document, const BufferView& bufferView) const
+            {
+                const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+                Validation::ValidateBufferView(bufferView, buffer);
+
+                auto count = bufferView.byteLength / sizeof(T);
+                assert(bufferView.byteLength % sizeof(T) == 0);
+
+                return ReadBinaryData<T>(buffer, bufferView.byteOffset, count);
+            }
+
+            // Reads the accessor's data into caller-provided memory (e.g. a mapped upload buffer or a pooled allocation)
+            // rather than into a new vector. componentCount is the capacity of data and must be at least the accessor's
+            // count multiplied by its number of components per element. Returns the number of components written.
+            template<typename T>
+            size_t ReadBinaryData(const Document& gltfDocument, const Accessor& accessor, T* data, size_t componentCount) const
+            {
+                ValidateComponentType<T>(accessor.componentType);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                const size_t requiredCount = accessor.count * Accessor::GetTypeCount(accessor.type);
+
+                if (componentCount < requiredCount)
+                {
+                    throw GLTFException("The destination is too small for the data of accessor " + accessor.id);
+                }
+
+                if (accessor.sparse.count > 0U)
+                {
+                    ReadSparseAccessor<T>(gltfDocument, accessor, data);
+                }
+                else
+                {
+                    ReadAccessor<T>(gltfDocument, accessor, data);
+                }
+
+                return requiredCount;
+            }
+
+            template<typename T>
+            size_t ReadBinaryData(const Document& document, const BufferView& bufferView, T* data, size_t componentCount) const
+            {
+                const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+                Validation::ValidateBufferView(bufferView, buffer);
+
+                auto count = bufferView.byteLength / sizeof(T);
+                assert(bufferView.byteLength % sizeof(T) == 0);
+
+                if (componentCount < count)
+                {
+                    throw GLTFException("The destination is too small for the data of buffer view " + bufferView.id);
+                }
+
+                ReadBinaryData<T>(buffer, bufferView.byteOffset, count, data);
+
+                return count;
+            }
+
+            // Writes only the sparse values of a sparse accessor to their elements in data, leaving all other elements
+            // untouched. The base data is neither read nor zero filled, so this suits callers that already hold the base
+            // data in data or only need the sparse delta (e.g. of a morph target). componentCount is the capacity of data
+            // as for ReadBinaryData. Returns the number of elements written.
+            template<typename T>
+            size_t ApplySparseBinaryData(const Document& gltfDocument, const Accessor& accessor, T* data, size_t componentCount) const
+            {
+                ValidateComponentType<T>(accessor.componentType);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                if (componentCount < accessor.count * Accessor::GetTypeCount(accessor.type))
+                {
+                    throw GLTFException("The destination is too small for the data of accessor " + accessor.id);
+                }
+
+                if (accessor.sparse.count > 0U)
+                {
+                    ApplySparseBinaryData<T>(gltfDocument, accessor, data);
+                }
+
+                return accessor.sparse.count;
+            }
+
+            // Returns a view of the accessor's data that points directly into the buffer's memory when possible (i.e. the
+            // buffer's stream is a MemoryStream, or it is a cached base64 buffer, and the accessor is neither sparse nor
+            // misaligned). Otherwise the data is read as it would be by ReadBinaryData and the returned view owns the copy.
+            template<typename T>
+            AccessorView<T> ReadBinaryDataView(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor.componentType);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                const auto typeCount = Accessor::GetTypeCount(accessor.type);
+
+                if (accessor.sparse.count > 0U)
+                {
+                    return AccessorView<T>(ReadSparseAccessor<T>(gltfDocument, accessor), typeCount, accessor.componentType);
+                }
+
+                const size_t elementSize = sizeof(T) * typeCount;
+
+                const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
+                const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
+
+                const size_t byteStride = bufferView.byteStride ? bufferView.byteStride.Get() : elementSize;
+
+                size_t byteCount;
+
+                if (auto memory = GetBinaryMemory(buffer, byteCount))
+                {
+                    const size_t offset = accessor.byteOffset + bufferView.byteOffset;
+                    const size_t span = accessor.count > 0U ? (accessor.count - 1U) * byteStride + elementSize : 0U;
+
+                    if (offset > byteCount || span > byteCount - offset)
+                    {
+                        throw GLTFException("Accessor data is outside the range of the buffer's binary data");
+                    }
+
+                    auto data = memory.get() + offset;
+
+                    if (reinterpret_cast<uintptr_t>(data) % alignof(T) == 0U && byteStride % alignof(T) == 0U)
+                    {
+                        return AccessorView<T>(std::shared_ptr<const T>(memory, reinterpret_cast<const T*>(data)), accessor.count, typeCount, byteStride, accessor.componentType);
+                    }
+                }
+
+                return AccessorView<T>(ReadAccessor<T>(gltfDocument, accessor), typeCount, accessor.componentType);
+            }
+
+            // Returns a sparse accessor's data without expanding it to accessor.count elements, so consumers such as morph
+            // targets can apply the sparse values directly. Throws if the sparse indices aren't strictly increasing, as
+            // required by the glTF specification. For accessors that aren't sparse the result has no indices or values.
+            template<typename T>
+            SparseAccessorView<T> ReadSparseBinaryDataView(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor.componentType);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                const auto typeCount = Accessor::GetTypeCount(accessor.type);
+
+                AccessorView<T> base;
+
+                if (!accessor.bufferViewId.empty())
+                {
+                    Accessor baseAccessor = accessor;
+                    baseAccessor.sparse = {};
+
+                    base = ReadBinaryDataView<T>(gltfDocument, baseAccessor);
+                }
+
+                if (accessor.sparse.count == 0U)
+                {
+                    return SparseAccessorView<T>(std::move(base), accessor.count, typeCount, {}, {});
+                }
+
+                // The indices and values are read as plain accessors into their buffer views
+                Accessor indicesAccessor;
+                indicesAccessor.id = accessor.id + "_sparseIndices";
+                indicesAccessor.bufferViewId = accessor.sparse.indicesBufferViewId;
+                indicesAccessor.byteOffset = accessor.sparse.indicesByteOffset;
+                indicesAccessor.componentType = accessor.sparse.indicesComponentType;
+                indicesAccessor.count = accessor.sparse.count;
+                indicesAccessor.type = TYPE_SCALAR;
+
+                std::vector<uint32_t> indices;
+
+                switch (accessor.sparse.indicesComponentType)
                 {
-                case COMPONENT_BYTE:
-                    isValid = std::is_same<T, int8_t>::value;
-                    break;
                 case COMPONENT_UNSIGNED_BYTE:
-                    isValid = std::is_same<T, uint8_t>::value;
-                    break;
-                case COMPONENT_SHORT:
-                    isValid = std::is_same<T, int16_t>::value;
+                    indices = ReadSparseIndices<uint8_t>(gltfDocument, indicesAccessor);
                     break;
                 case COMPONENT_UNSIGNED_SHORT:
-                    isValid = std::is_same<T, uint16_t>::value;
+                    indices = ReadSparseIndices<uint16_t>(gltfDocument, indicesAccessor);
                     break;
                 case COMPONENT_UNSIGNED_INT:
-                    isValid = std::is_same<T, uint32_t>::value;
-                    break;
-                case COMPONENT_FLOAT:
-                    isValid = std::is_same<T, float>::value;
+                    indices = ReadBinaryData<uint32_t>(gltfDocument, indicesAccessor);
                     break;
                 default:
-                    throw GLTFException("Unsupported accessor ComponentType");
+                    throw GLTFException("Unsupported sparse indices ComponentType");
                 }
 
-                if (!isValid)
+                for (size_t i = 0U; i < indices.size(); ++i)
                 {
-                    throw GLTFException("ReadAccessorData: Template type T does not match accessor ComponentType");
+                    if ((i > 0U && indices[i] <= indices[i - 1U]) || indices[i] >= accessor.count)
+                    {
+                        throw GLTFException("Sparse accessor indices must be strictly increasing and less than the count of accessor " + accessor.id);
+                    }
                 }
 
-                Validation::ValidateAccessor(gltfDocument, accessor);
+                Accessor valuesAccessor;
+                valuesAccessor.id = accessor.id + "_sparseValues";
+                valuesAccessor.bufferViewId = accessor.sparse.valuesBufferViewId;
+                valuesAccessor.byteOffset = accessor.sparse.valuesByteOffset;
+                valuesAccessor.componentType = accessor.componentType;
+                valuesAccessor.count = accessor.sparse.count;
+                valuesAccessor.type = accessor.type;
 
-                if (accessor.sparse.count > 0U)
-                {
-                    return ReadSparseAccessor<T>(gltfDocument, accessor);
-                }
+                auto values = ReadBinaryDataView<T>(gltfDocument, valuesAccessor);
 
-                return ReadAccessor<T>(gltfDocument, accessor);
+                return SparseAccessorView<T>(std::move(base), accessor.count, typeCount, std::move(indices), std::move(values));
             }
 
+            // Reads the data of many accessors at once. The byte ranges of each buffer's accessors are sorted and those that
+            // overlap or are separated by no more than GetMaxReadGap() bytes are coalesced (see CoalesceByteRanges), so an
+            // external buffer is read with a few large sequential reads rather than one read per accessor. Base64 buffers
+            // only coalesce adjacent or overlapping ranges as decoding a gap isn't free. The data is then decoded and
+            // de-interleaved on up to threadCount threads (0 uses one thread per hardware thread). The results are in the
+            // same order as accessorIds. One thread per hardware thread uses a shared thread pool that is created on first
+            // use. Any other thread count above 1 creates and joins a new pool on every call, so callers that make many
+            // batch reads with a specific number of threads should pass their own executor to the overload below.
+            std::vector<AccessorData> ReadBinaryDataBatch(const Document& document, const std::vector<std::string>& accessorIds, size_t threadCount = 0U) const;
+
+            // As above, but decodes on the executor's threads. The calling thread takes part in the work too, so this may be
+            // called from one of the executor's own tasks.
+            std::vector<AccessorData> ReadBinaryDataBatch(const Document& document, const std::vector<std::string>& accessorIds, IExecutor& executor) const;
+
+            // Reads the data of a mesh primitive's indices, attribute and morph target accessors, keyed by accessor id
+            std::unordered_map<std::string, AccessorData> ReadBinaryDataBatch(const Document& document, const MeshPrimitive& meshPrimitive, size_t threadCount = 0U) const;
+            std::unordered_map<std::string, AccessorData> ReadBinaryDataBatch(const Document& document, const MeshPrimitive& meshPrimitive, IExecutor& executor) const;
+
+            // Asynchronous reads. Each read runs as a single task on the executor and its result (or exception) is returned
+            // via a future, or passed to a callback that is called on the thread that ran the task. The reader and the
+            // document must remain valid until the read completes. Unless the executor runs one task at a time the reader
+            // must be set up for concurrent use (see above).
             template<typename T>
-            std::vector<T> ReadBinaryData(const Document& document, const BufferView& bufferView) const
+            using ReadCallback = std::function<void(std::vector<T> data, std::exception_ptr exception)>;
+
+            template<typename T>
+            std::future<std::vector<T>> ReadBinaryDataAsync(const Document& document, const Accessor& accessor, IExecutor& executor) const
             {
-                const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+                return ExecuteAsync(executor, [this, &document, &accessor]() { return ReadBinaryData<T>(document, accessor); });
+            }
 
-                Validation::ValidateBufferView(bufferView, buffer);
+            template<typename T>
+            void ReadBinaryDataAsync(const Document& document, const Accessor& accessor, IExecutor& executor, ReadCallback<T> callback) const
+            {
+                ExecuteAsync(executor, [this, &document, &accessor]() { return ReadBinaryData<T>(document, accessor); }, std::move(callback));
+            }
 
-                auto count = bufferView.byteLength / sizeof(T);
-                assert(bufferView.byteLength % sizeof(T) == 0);
+            template<typename T>
+            std::future<std::vector<T>> ReadBinaryDataAsync(const Document& document, const BufferView& bufferView, IExecutor& executor) const
+            {
+                return ExecuteAsync(executor, [this, &document, &bufferView]() { return ReadBinaryData<T>(document, bufferView); });
+            }
 
-                return ReadBinaryData<T>(buffer, bufferView.byteOffset, count);
+            template<typename T>
+            void ReadBinaryDataAsync(const Document& document, const BufferView& bufferView, IExecutor& executor, ReadCallback<T> callback) const
+            {
+                ExecuteAsync(executor, [this, &document, &bufferView]() { return ReadBinaryData<T>(document, bufferView); }, std::move(callback));
+            }
+
+            std::future<std::vector<uint8_t>> ReadBinaryDataAsync(const Document& document, const Image& image, IExecutor& executor) const
+            {
+                return ExecuteAsync(executor, [this, &document, &image]() { return ReadBinaryData(document, image); });
+            }
+
+            void ReadBinaryDataAsync(const Document& document, const Image& image, IExecutor& executor, ReadCallback<uint8_t> callback) const
+            {
+                ExecuteAsync(executor, [this, &document, &image]() { return ReadBinaryData(document, image); }, std::move(callback));
             }
 
         protected:
+            // Returns the reader supplied at construction, or nullptr if resources are read via streams
+            const std::shared_ptr<const IRandomAccessReader>& GetRandomAccessReader() const
+            {
+                return m_randomAccessReader;
+            }
+
             template<typename T>
             std::vector<T> ReadAccessor(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+                ReadAccessor<T>(gltfDocument, accessor, data.data());
+                return data;
+            }
+
+            // Reads the accessor's accessor.count * typeCount components into data
+            template<typename T>
+            void ReadAccessor(const Document& gltfDocument, const Accessor& accessor, T* data) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
                 const auto elementSize = sizeof(T) * typeCount;
 
-                std::vector<T> data;
-
                 const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
                 const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
 
@@ -139,61 +462,54 @@ namespace Microsoft
 
                 if (!bufferView.byteStride || bufferView.byteStride.Get() == elementSize)
                 {
-                    data = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
+                    ReadBinaryData<T>(buffer, offset, accessor.count * typeCount, data);
                 }
                 else
                 {
-                    data = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get());
+                    ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get(), data);
                 }
-
-                return data;
             }
 
             template<typename T>
             std::vector<T> ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor) const
             {
-                const auto typeCount = Accessor::GetTypeCount(accessor.type);
-                const auto elementSize = sizeof(T) * typeCount;
-
-                std::vector<T> baseData;
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+                ReadSparseAccessor<T>(gltfDocument, accessor, data.data());
+                return data;
+            }
 
+            template<typename T>
+            void ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor, T* data) const
+            {
                 if (accessor.bufferViewId.empty())
                 {
-                    baseData.resize(typeCount * accessor.count, T());
+                    std::fill_n(data, accessor.count * Accessor::GetTypeCount(accessor.type), T());
                 }
                 else
                 {
-                    const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
-                    const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
-
-                    const size_t offset = accessor.byteOffset + bufferView.byteOffset;
-
-                    if (!bufferView.byteStride || bufferView.byteStride.Get() == elementSize)
-                    {
-                        baseData = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
-                    }
-                    else
-                    {
-                        baseData = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get());
-                    }
+                    ReadAccessor<T>(gltfDocument, accessor, data);
                 }
 
+                ApplySparseBinaryData<T>(gltfDocument, accessor, data);
+            }
+
+            template<typename T>
+            void ApplySparseBinaryData(const Document& gltfDocument, const Accessor& accessor, T* data) const
+            {
                 switch (accessor.sparse.indicesComponentType)
                 {
                 case COMPONENT_UNSIGNED_BYTE:
-                    ReadSparseBinaryData<T, uint8_t>(gltfDocument, baseData, accessor);
+                    ReadSparseBinaryData<T, uint8_t>(gltfDocument, data, accessor);
                     break;
                 case COMPONENT_UNSIGNED_SHORT:
-                    ReadSparseBinaryData<T, uint16_t>(gltfDocument, baseData, accessor);
+                    ReadSparseBinaryData<T, uint16_t>(gltfDocument, data, accessor);
                     break;
                 case COMPONENT_UNSIGNED_INT:
-                    ReadSparseBinaryData<T, uint32_t>(gltfDocument, baseData, accessor);
+                    ReadSparseBinaryData<T, uint32_t>(gltfDocument, data, accessor);
                     break;
                 default:
                     throw GLTFException("Unsupported sparse indices ComponentType");
                 }
-
-                return baseData;
             }
 
             virtual std::shared_ptr<std::istream> GetBinaryStream(const Buffer& buffer) const
@@ -203,6 +519,11 @@ namespace Microsoft
                     throw GLTFException("Buffer.uri was not specified.");
                 }
 
+                if (!m_streamReaderCache)
+                {
+                    throw GLTFException("Buffer streams are unavailable when reading via an IRandomAccessReader");
+                }
+
                 return m_streamReaderCache->Get(buffer.uri);
             }
 
@@ -211,7 +532,123 @@ namespace Microsoft
                 return {};
             }
 
+            // Reads byteCount bytes starting offset bytes into the buffer. Each call seeks the stream before reading so
+            // callers never depend on the stream's current position.
+            virtual void ReadBinaryStream(const Buffer& buffer, std::streamoff offset, void* data, size_t byteCount) const
+            {
+                if (m_randomAccessReader)
+                {
+                    if (buffer.uri.empty())
+                    {
+                        throw GLTFException("Buffer.uri was not specified.");
+                    }
+
+                    if (offset < 0)
+                    {
+                        throw GLTFException("Negative offsets are not supported");
+                    }
+
+                    m_randomAccessReader->ReadAt(buffer.uri, static_cast<size_t>(offset), byteCount, data);
+                    return;
+                }
+
+                auto bufferStream = GetBinaryStream(buffer);
+                auto bufferStreamPos = GetBinaryStreamPos(buffer);
+
+                bufferStream->seekg(bufferStreamPos + offset);
+
+                StreamUtils::ReadBinary(*bufferStream, static_cast<char*>(data), byteCount);
+            }
+
+            // Returns a pointer to the buffer's binary data when it is already resident in memory, or nullptr when the
+            // data can only be accessed via GetBinaryStream. On success byteCount is set to the number of bytes available.
+            virtual std::shared_ptr<const uint8_t> GetBinaryMemory(const Buffer& buffer, size_t& byteCount) const
+            {
+                std::string::const_iterator itBegin;
+                std::string::const_iterator itEnd;
+
+                if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                {
+                    if (m_base64Cache)
+                    {
+                        if (auto decodedData = m_base64Cache->Get(buffer, { itBegin, itEnd }))
+                        {
+                            byteCount = decodedData->size();
+                            return std::shared_ptr<const uint8_t>(decodedData, decodedData->data());
+                        }
+                    }
+
+                    return {};
+                }
+
+                if (m_randomAccessReader)
+                {
+                    return {};
+                }
+
+                auto memoryStream = std::dynamic_pointer_cast<MemoryStream>(GetBinaryStream(buffer));
+
+                if (!memoryStream)
+                {
+                    return {};
+                }
+
+                const std::streamoff memoryPos = GetBinaryStreamPos(buffer);
+
+                if (memoryPos < 0 || static_cast<size_t>(memoryPos) > memoryStream->GetByteLength())
+                {
+                    return {};
+                }
+
+                byteCount = memoryStream->GetByteLength() - static_cast<size_t>(memoryPos);
+
+                return std::shared_ptr<const uint8_t>(memoryStream->GetData(), memoryStream->GetData().get() + memoryPos);
+            }
+
         private:
+            template<typename Fn>
+            static std::future<decltype(std::declval<Fn>()())> ExecuteAsync(IExecutor& executor, Fn fn)
+            {
+                // std::function requires a copyable callable so the (move only) packaged_task is shared
+                auto task = std::make_shared<std::packaged_task<decltype(fn())()>>(std::move(fn));
+                auto future = task->get_future();
+
+                executor.Execute([task]() { (*task)(); });
+
+                return future;
+            }
+
+            template<typename Fn, typename T>
+            static void ExecuteAsync(IExecutor& executor, Fn fn, ReadCallback<T> callback)
+            {
+                executor.Execute([fn, callback]()
+                {
+                    std::vector<T> data;
+                    std::exception_ptr exception;
+
+                    try
+                    {
+                        data = fn();
+                    }
+                    catch (...)
+                    {
+                        exception = std::current_exception();
+                    }
+
+                    callback(std::move(data), exception);
+                });
+            }
+
+            template<typename I>
+            std::vector<uint32_t> ReadSparseIndices(const Document& gltfDocument, const Accessor& indicesAccessor) const
+            {
+                const auto indices = ReadBinaryData<I>(gltfDocument, indicesAccessor);
+                return std::vector<uint32_t>(indices.begin(), indices.end());
+            }
+
+            // Reads the accessor's data as its component type and returns it as untyped AccessorData
+            AccessorData ReadAccessorData(const Document& document, const Accessor& accessor) const;
+
             void ReadBinaryDataUri(Base64StringView encodedData, Base64BufferView decodedData, const std::streamoff* offsetOverride = nullptr) const
             {
                 // The number of unwanted extra bytes that must be decoded for the specified byte offset
@@ -285,70 +722,212 @@ namespace Microsoft
             template<typename T>
             std::vector<T> ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount) const
             {
-                std::vector<T> data;
+                std::vector<T> data(componentCount);
+                ReadBinaryData<T>(buffer, offset, componentCount, data.data());
+                return data;
+            }
 
+            template<typename T>
+            void ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount, T* data) const
+            {
                 std::string::const_iterator itBegin;
                 std::string::const_iterator itEnd;
 
-                if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                const size_t byteLength = componentCount * sizeof(T);
+
+                size_t byteCount;
+
+                if (auto memory = GetBinaryMemory(buffer, byteCount))
                 {
-                    data = ReadBinaryDataUri<T>({ itBegin, itEnd }, &offset, &componentCount);
+                    if (offset < 0 || static_cast<size_t>(offset) > byteCount || byteLength > byteCount - static_cast<size_t>(offset))
+                    {
+                        throw GLTFException("Buffer data is outside the range of the buffer's binary data");
+                    }
+
+                    std::memcpy(data, memory.get() + offset, byteLength);
+                }
+                else if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                {
+                    ReadBinaryDataUri({ itBegin, itEnd }, Base64BufferView(data, byteLength), &offset);
                 }
                 else
                 {
-                    data.resize(componentCount);
-
-                    auto bufferStream = GetBinaryStream(buffer);
-                    auto bufferStreamPos = GetBinaryStreamPos(buffer);
-
-                    bufferStream->seekg(bufferStreamPos);
-                    bufferStream->seekg(offset, std::ios_base::cur);
-
-                    StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data()), componentCount * sizeof(T));
+                    ReadBinaryStream(buffer, offset, data, byteLength);
                 }
+            }
 
+            template<typename T>
+            std::vector<T> ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride) const
+            {
+                std::vector<T> data(elementCount * typeCount);
+                ReadBinaryDataInterleaved<T>(buffer, offset, elementCount, typeCount, stride, data.data());
                 return data;
             }
 
             template<typename T>
-            std::vector<T> ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride) const
+            void ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride, T* data) const
             {
                 const size_t elementSize = sizeof(T) * typeCount;
-                const size_t componentCount = elementCount * typeCount;
 
-                std::vector<T> data(componentCount);
+                if (elementCount == 0U)
+                {
+                    return;
+                }
+
+                auto dataBytes = reinterpret_cast<uint8_t*>(data);
+
+                // The number of bytes from the start of the first element to the end of the last element. The padding
+                // following the last element isn't included as the buffer view isn't required to contain it.
+                const size_t spanByteLength = (elementCount - 1U) * stride + elementSize;
 
                 std::string::const_iterator itBegin;
                 std::string::const_iterator itEnd;
 
-                if (IsUriBase64(buffer.uri, itBegin, itEnd))
-                {
-                    Base64StringView encodedData(itBegin, itEnd);
+                size_t byteCount;
 
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount, offset += stride)
+                if (auto memory = GetBinaryMemory(buffer, byteCount))
+                {
+                    if (offset < 0 || static_cast<size_t>(offset) > byteCount || spanByteLength > byteCount - static_cast<size_t>(offset))
                     {
-                        ReadBinaryDataUri(encodedData, Base64BufferView(data.data() + componentsRead, elementSize), &offset);
+                        throw GLTFException("Buffer data is outside the range of the buffer's binary data");
                     }
+
+                    GatherElements(memory.get() + offset, dataBytes, elementCount, elementSize, stride);
+                }
+                else if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                {
+                    // Decode the entire span once and then gather the elements from it
+                    std::vector<uint8_t> spanData(spanByteLength);
+                    ReadBinaryDataUri({ itBegin, itEnd }, Base64BufferView(spanData), &offset);
+
+                    GatherElements(spanData.data(), dataBytes, elementCount, elementSize, stride);
                 }
                 else
                 {
-                    auto bufferStream = GetBinaryStream(buffer);
-                    auto bufferStreamPos = GetBinaryStreamPos(buffer) + offset;
+                    // Read the span in large blocks of whole elements, bounding the temporary memory required for large buffer views
+                    constexpr size_t blockByteLength = 1024U * 1024U;
+
+                    const size_t blockElementCount = std::max<size_t>(1U, blockByteLength / std::max<size_t>(1U, stride));
 
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount)
+                    std::vector<uint8_t> blockData;
+
+                    for (size_t elementsRead = 0U; elementsRead < elementCount;)
                     {
-                        bufferStream->seekg(bufferStreamPos);
-                        bufferStreamPos += stride;
+                        const size_t elementsToRead = std::min(blockElementCount, elementCount - elementsRead);
+                        const size_t bytesToRead = (elementsToRead - 1U) * stride + elementSize;
+
+                        blockData.resize(bytesToRead);
+
+                        ReadBinaryStream(buffer, offset + static_cast<std::streamoff>(elementsRead * stride), blockData.data(), bytesToRead);
 
-                        StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data() + componentsRead), elementSize);
+                        GatherElements(blockData.data(), dataBytes + elementsRead * elementSize, elementsToRead, elementSize, stride);
+
+                        elementsRead += elementsToRead;
                     }
                 }
+            }
 
-                return data;
+            template<size_t ElementSize>
+            static void GatherElements(const uint8_t* src, uint8_t* dst, size_t elementCount, size_t stride)
+            {
+                // ElementSize is a compile-time constant so each memcpy compiles down to one or two (vector) loads and stores
+                for (size_t i = 0U; i < elementCount; ++i, src += stride, dst += ElementSize)
+                {
+                    std::memcpy(dst, src, ElementSize);
+                }
+            }
+
+            // Copies elementCount elements of elementSize bytes each, spaced stride bytes apart in src, to the tightly packed dst
+            static void GatherElements(const uint8_t* src, uint8_t* dst, size_t elementCount, size_t elementSize, size_t stride)
+            {
+                // Specialize for the element sizes of the common accessor type and component type combinations
+                switch (elementSize)
+                {
+                case 1U:
+                    return GatherElements<1U>(src, dst, elementCount, stride);
+                case 2U:
+                    return GatherElements<2U>(src, dst, elementCount, stride);
+                case 3U:
+                    return GatherElements<3U>(src, dst, elementCount, stride);
+                case 4U:
+                    return GatherElements<4U>(src, dst, elementCount, stride);
+                case 6U:
+                    return GatherElements<6U>(src, dst, elementCount, stride);
+                case 8U:
+                    return GatherElements<8U>(src, dst, elementCount, stride);
+                case 12U:
+                    return GatherElements<12U>(src, dst, elementCount, stride);
+                case 16U:
+                    return GatherElements<16U>(src, dst, elementCount, stride);
+                }
+
+                for (size_t i = 0U; i < elementCount; ++i, src += stride, dst += elementSize)
+                {
+                    std::memcpy(dst, src, elementSize);
+                }
+            }
+
+            template<size_t ElementSize, typename I>
+            static bool ScatterElements(const I* indices, const uint8_t* src, uint8_t* dst, size_t count, size_t stride, size_t elementCount)
+            {
+                // As for GatherElements, a compile-time ElementSize turns each memcpy into one or two (vector) loads and stores
+                for (size_t i = 0U; i < count; ++i, src += stride)
+                {
+                    const size_t index = indices[i];
+
+                    if (index >= elementCount)
+                    {
+                        return false;
+                    }
+
+                    std::memcpy(dst + index * ElementSize, src, ElementSize);
+                }
+
+                return true;
+            }
+
+            // Copies count elements of elementSize bytes each, spaced stride bytes apart in src, to the elements of dst
+            // given by indices. Returns false, having stopped early, if an index isn't less than elementCount.
+            template<typename I>
+            static bool ScatterElements(const I* indices, const uint8_t* src, uint8_t* dst, size_t count, size_t elementSize, size_t stride, size_t elementCount)
+            {
+                switch (elementSize)
+                {
+                case 1U:
+                    return ScatterElements<1U>(indices, src, dst, count, stride, elementCount);
+                case 2U:
+                    return ScatterElements<2U>(indices, src, dst, count, stride, elementCount);
+                case 3U:
+                    return ScatterElements<3U>(indices, src, dst, count, stride, elementCount);
+                case 4U:
+                    return ScatterElements<4U>(indices, src, dst, count, stride, elementCount);
+                case 6U:
+                    return ScatterElements<6U>(indices, src, dst, count, stride, elementCount);
+                case 8U:
+                    return ScatterElements<8U>(indices, src, dst, count, stride, elementCount);
+                case 12U:
+                    return ScatterElements<12U>(indices, src, dst, count, stride, elementCount);
+                case 16U:
+                    return ScatterElements<16U>(indices, src, dst, count, stride, elementCount);
+                }
+
+                for (size_t i = 0U; i < count; ++i, src += stride)
+                {
+                    const size_t index = indices[i];
+
+                    if (index >= elementCount)
+                    {
+                        return false;
+                    }
+
+                    std::memcpy(dst + index * elementSize, src, elementSize);
+                }
+
+                return true;
             }
 
             template<typename T, typename I>
-            void ReadSparseBinaryData(const Document& gltfDocument, std::vector<T>& baseData, const Accessor& accessor) const
+            void ReadSparseBinaryData(const Document& gltfDocument, T* baseData, const Accessor& accessor) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
                 const auto elementSize = sizeof(T) * typeCount;
@@ -374,27 +953,53 @@ namespace Microsoft
                     indices = ReadBinaryDataInterleaved<I>(indicesBuffer, indicesOffset, count, 1U, indicesBufferView.byteStride.Get());
                 }
 
+                size_t valuesStride = valuesBufferView.byteStride ? valuesBufferView.byteStride.Get() : elementSize;
+
+                // Scatter the values directly from the buffer's memory when it's resident, otherwise from a packed copy
                 std::vector<T> values;
+                size_t byteCount;
+
+                auto memory = GetBinaryMemory(valuesBuffer, byteCount);
+                const uint8_t* valuesData;
 
-                if (!valuesBufferView.byteStride || valuesBufferView.byteStride.Get() == elementSize)
+                if (memory)
                 {
-                    values = ReadBinaryData<T>(valuesBuffer, valuesOffset, count * typeCount);
+                    const size_t spanByteLength = count > 0U ? (count - 1U) * valuesStride + elementSize : 0U;
+
+                    if (valuesOffset > byteCount || spanByteLength > byteCount - valuesOffset)
+                    {
+                        throw GLTFException("Buffer data is outside the range of the buffer's binary data");
+                    }
+
+                    valuesData = memory.get() + valuesOffset;
                 }
                 else
                 {
-                    values = ReadBinaryDataInterleaved<T>(valuesBuffer, valuesOffset, count, typeCount, valuesBufferView.byteStride.Get());
+                    if (valuesStride == elementSize)
+                    {
+                        values = ReadBinaryData<T>(valuesBuffer, valuesOffset, count * typeCount);
+                    }
+                    else
+                    {
+                        values = ReadBinaryDataInterleaved<T>(valuesBuffer, valuesOffset, count, typeCount, valuesStride);
+                    }
+
+                    valuesData = reinterpret_cast<const uint8_t*>(values.data());
+                    valuesStride = elementSize;
                 }
 
-                for (size_t i = 0; i < indices.size(); i++)
+                // baseData may be caller-provided memory, so an out of range index mustn't write past its end
+                if (!ScatterElements(indices.data(), valuesData, reinterpret_cast<uint8_t*>(baseData), count, elementSize, valuesStride, accessor.count))
                 {
-                    for (size_t j = 0; j < typeCount; j++)
-                    {
-                        baseData[indices[i] * typeCount + j] = values[i * typeCount + j];
-                    }
+                    throw GLTFException("Sparse accessor index is outside the range of accessor " + accessor.id);
                 }
             }
 
             std::unique_ptr<IStreamReaderCache> m_streamReaderCache;
+            std::shared_ptr<const IRandomAccessReader> m_randomAccessReader;
+            std::unique_ptr<Base64BufferCache> m_base64Cache;
+
+            size_t m_maxReadGapByteLength;
         };
     }
 }
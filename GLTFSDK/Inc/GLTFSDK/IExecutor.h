@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Runs the tasks issued by the asynchronous and batch read functions of GLTFResourceReader and by the parallel
+        // Deserialize overloads. Implement this to run them on an existing job system or thread pool. Tasks don't throw
+        // exceptions.
+        class IExecutor
+        {
+        public:
+            virtual ~IExecutor() = default;
+
+            // Runs the task, either immediately on the calling thread or at some later point on any thread
+            virtual void Execute(std::function<void()> task) = 0;
+
+            // The number of tasks that can run at once, used to decide how many tasks to split work into
+            virtual size_t GetConcurrency() const = 0;
+        };
+
+        // Runs each task immediately on the calling thread
+        class InlineExecutor : public IExecutor
+        {
+        public:
+            void Execute(std::function<void()> task) override
+            {
+                task();
+            }
+
+            size_t GetConcurrency() const override
+            {
+                return 1U;
+            }
+        };
+
+        // Calls fn(i) for each i in [0, count). The calling thread and helper tasks issued to the executor take indices from
+        // a shared counter until none remain, so the work always completes even if the executor doesn't get round to running
+        // the helpers (e.g. when called from one of its own tasks). Helpers that start late find no work and return without
+        // touching fn. The first exception thrown by fn skips the remaining work and is rethrown on the calling thread.
+        template<typename Fn>
+        void ParallelFor(size_t count, IExecutor& executor, const Fn& fn)
+        {
+            struct State
+            {
+                std::atomic<size_t> next;
+                std::atomic<size_t> completed;
+                std::atomic<bool> isFailed;
+
+                std::exception_ptr exception;
+
+                std::mutex mutex;
+                std::condition_variable condition;
+            };
+
+            if (count == 0U)
+            {
+                return;
+            }
+
+            auto state = std::make_shared<State>();
+            state->next = 0U;
+            state->completed = 0U;
+            state->isFailed = false;
+
+            auto work = [state, count, &fn]()
+            {
+                for (size_t i = state->next++; i < count; i = state->next++)
+                {
+                    if (!state->isFailed)
+                    {
+                        try
+                        {
+                            fn(i);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(state->mutex);
+
+                            if (!state->exception)
+                            {
+                                state->exception = std::current_exception();
+                            }
+
+                            state->isFailed = true;
+                        }
+                    }
+
+                    if (++state->completed == count)
+                    {
+                        std::lock_guard<std::mutex> lock(state->mutex);
+                        state->condition.notify_all();
+                    }
+                }
+            };
+
+            const size_t helperCount = std::min(count - 1U, executor.GetConcurrency());
+
+            for (size_t i = 0U; i < helperCount; ++i)
+            {
+                executor.Execute(work);
+            }
+
+            work();
+
+            std::unique_lock<std::mutex> lock(state->mutex);
+
+            state->condition.wait(lock, [&state, count]() { return state->completed == count; });
+
+            if (state->exception)
+            {
+                std::rethrow_exception(state->exception);
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/IStreamReader.h>
+#include <GLTFSDK/StreamCacheThreadLocal.h>
+#include <GLTFSDK/StreamUtils.h>
+
+#include <memory>
+#include <string>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Provides positional (pread style) access to the resources referenced by a glTF document. Unlike IStreamReader
+        // there is no read position, so implementations must allow ReadAt and Size to be called concurrently.
+        class IRandomAccessReader
+        {
+        public:
+            virtual ~IRandomAccessReader() = default;
+
+            // Reads byteCount bytes starting at offset into data. Throws if fewer than byteCount bytes can be read.
+            virtual void ReadAt(const std::string& uri, size_t offset, size_t byteCount, void* data) const = 0;
+
+            // Returns the total size of the resource in bytes
+            virtual size_t Size(const std::string& uri) const = 0;
+        };
+
+        // Adapts an IStreamReader to IRandomAccessReader. Each thread reads from its own streams, which are cached (up to
+        // cacheMaxSize per thread) so each resource is only opened once per thread.
+        class StreamRandomAccessReader : public IRandomAccessReader
+        {
+        public:
+            StreamRandomAccessReader(std::shared_ptr<const IStreamReader> streamReader, size_t cacheMaxSize = 16U)
+                : m_streamReaderCache(MakeStreamReaderCache<StreamReaderCacheThreadLocal>(std::move(streamReader), cacheMaxSize))
+            {
+            }
+
+            void ReadAt(const std::string& uri, size_t offset, size_t byteCount, void* data) const override
+            {
+                auto stream = m_streamReaderCache->Get(uri);
+
+                stream->clear();
+                stream->seekg(static_cast<std::streamoff>(offset));
+
+                StreamUtils::ReadBinary(*stream, static_cast<char*>(data), byteCount);
+            }
+
+            size_t Size(const std::string& uri) const override
+            {
+                auto stream = m_streamReaderCache->Get(uri);
+
+                stream->clear();
+                stream->seekg(0, std::ios_base::end);
+
+                const std::streamoff size = stream->tellg();
+
+                if (size < 0)
+                {
+                    throw GLTFException("Unable to determine the size of " + uri);
+                }
+
+                return static_cast<size_t>(size);
+            }
+
+            // Closes the streams opened by the calling thread, e.g. before a worker thread exits
+            void ReleaseThreadStreams() const
+            {
+                m_streamReaderCache->ReleaseThreadCache();
+            }
+
+        private:
+            std::unique_ptr<StreamReaderCacheThreadLocal> m_streamReaderCache;
+        };
+    }
+}
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Document.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        struct IndexedAccessor
+        {
+            uint32_t bufferView;
+            uint32_t sparseIndicesBufferView;
+            uint32_t sparseValuesBufferView;
+        };
+
+        struct IndexedBufferView
+        {
+            uint32_t buffer;
+        };
+
+        struct IndexedAttribute
+        {
+            std::string name;
+            uint32_t accessor;
+        };
+
+        struct IndexedMorphTarget
+        {
+            uint32_t positionsAccessor;
+            uint32_t normalsAccessor;
+            uint32_t tangentsAccessor;
+        };
+
+        struct IndexedMeshPrimitive
+        {
+            std::vector<IndexedAttribute> attributes;// Sorted by name
+            uint32_t indicesAccessor;
+            uint32_t material;
+            std::vector<IndexedMorphTarget> targets;
+
+            // Returns IndexedDocument::InvalidIndex if the primitive has no such attribute
+            uint32_t GetAttributeAccessor(const std::string& name) const;
+        };
+
+        struct IndexedMesh
+        {
+            std::vector<IndexedMeshPrimitive> primitives;
+        };
+
+        struct IndexedMaterial
+        {
+            uint32_t baseColorTexture;
+            uint32_t metallicRoughnessTexture;
+            uint32_t normalTexture;
+            uint32_t occlusionTexture;
+            uint32_t emissiveTexture;
+        };
+
+        struct IndexedTexture
+        {
+            uint32_t sampler;
+            uint32_t image;
+        };
+
+        struct IndexedImage
+        {
+            uint32_t bufferView;
+        };
+
+        struct IndexedNode
+        {
+            uint32_t camera;
+            uint32_t mesh;
+            uint32_t skin;
+            std::vector<uint32_t> children;
+        };
+
+        struct IndexedScene
+        {
+            std::vector<uint32_t> nodes;
+        };
+
+        struct IndexedSkin
+        {
+            uint32_t inverseBindMatricesAccessor;
+            uint32_t skeleton;
+            std::vector<uint32_t> joints;
+        };
+
+        struct IndexedAnimationChannel
+        {
+            uint32_t sampler;// Index into the animation's samplers
+            uint32_t targetNode;
+        };
+
+        struct IndexedAnimationSampler
+        {
+            uint32_t inputAccessor;
+            uint32_t outputAccessor;
+        };
+
+        struct IndexedAnimation
+        {
+            std::vector<IndexedAnimationChannel> channels;
+            std::vector<IndexedAnimationSampler> samplers;
+        };
+
+        // A compact copy of a Document's cross-references, with each string id resolved once to the 32-bit index of the
+        // element it refers to. Walking the scene graph or the mesh data through an IndexedDocument needs no string
+        // hashing or allocation. The elements themselves are still accessed through the Document by index, e.g.
+        // document.nodes[indexedDocument.nodes[i].children[0]], and every vector here has the same size and order as
+        // the Document's container of the same name. References that aren't set are InvalidIndex.
+        //
+        // Note: only the cost of using the references is reduced, not the cost of loading them. Deserialize still creates
+        // a string id for every reference, and creating an IndexedDocument looks up each id once more. It pays off when
+        // the references are followed many times, e.g. when walking the scene graph every frame. The IndexedDocument
+        // doesn't track later changes to the Document it was created from.
+        class IndexedDocument
+        {
+        public:
+            static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+            // Throws a GLTFException if the document refers to an element that doesn't exist or if a container has too many
+            // elements for a 32-bit index
+            explicit IndexedDocument(const Document& document);
+
+            std::vector<IndexedAccessor> accessors;
+            std::vector<IndexedAnimation> animations;
+            std::vector<IndexedBufferView> bufferViews;
+            std::vector<IndexedImage> images;
+            std::vector<IndexedMaterial> materials;
+            std::vector<IndexedMesh> meshes;
+            std::vector<IndexedNode> nodes;
+            std::vector<IndexedScene> scenes;
+            std::vector<IndexedSkin> skins;
+            std::vector<IndexedTexture> textures;
+
+            uint32_t defaultScene;
+        };
+    }
+}
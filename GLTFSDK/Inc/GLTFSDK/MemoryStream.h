@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A read-only stream buffer over a contiguous block of memory
+        class MemoryStreamBuffer : public std::streambuf
+        {
+        public:
+            MemoryStreamBuffer(const uint8_t* data, size_t byteLength)
+            {
+                // The get area is never written to, the const_cast is only required by the std::streambuf interface
+                auto begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+                setg(begin, begin, begin + byteLength);
+            }
+
+        protected:
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+            {
+                if (!(which & std::ios_base::in))
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                off_type base;
+
+                switch (dir)
+                {
+                case std::ios_base::beg:
+                    base = 0;
+                    break;
+                case std::ios_base::cur:
+                    base = gptr() - eback();
+                    break;
+                case std::ios_base::end:
+                    base = egptr() - eback();
+                    break;
+                default:
+                    return pos_type(off_type(-1));
+                }
+
+                return seekpos(pos_type(base + off), which);
+            }
+
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+            {
+                const off_type off = pos;
+
+                if (!(which & std::ios_base::in) || off < 0 || off > (egptr() - eback()))
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                setg(eback(), eback() + off, egptr());
+                return pos;
+            }
+
+            std::streamsize showmanyc() override
+            {
+                const std::streamsize available = egptr() - gptr();
+                return available > 0 ? available : -1;
+            }
+
+            std::streamsize xsgetn(char* s, std::streamsize n) override
+            {
+                const std::streamsize available = egptr() - gptr();
+                const std::streamsize count = n < available ? n : available;
+
+                if (count > 0)
+                {
+                    std::memcpy(s, gptr(), static_cast<size_t>(count));
+                    setg(eback(), gptr() + count, egptr());// gbump takes an int so can't be used for reads larger than 2GB
+                }
+
+                return count;
+            }
+        };
+
+        // An input stream over memory that is already resident (e.g. a GLB file loaded into a byte vector). Readers
+        // that recognize a MemoryStream can access its bytes directly rather than copying them out with seekg/read.
+        class MemoryStream : public std::istream
+        {
+        public:
+            MemoryStream(std::shared_ptr<const uint8_t> data, size_t byteLength)
+                : std::istream(nullptr),
+                m_data(std::move(data)),
+                m_byteLength(byteLength),
+                m_streamBuffer(m_data.get(), m_byteLength)
+            {
+                rdbuf(&m_streamBuffer);
+            }
+
+            MemoryStream(std::shared_ptr<const std::vector<uint8_t>> data)
+                : MemoryStream(std::shared_ptr<const uint8_t>(data, data->data()), data->size())
+            {
+            }
+
+            // Maps the specified file into memory (read-only) and returns a stream over the mapped bytes. The mapping is
+            // released when the stream, and any pointers obtained from GetData, are destroyed.
+            static std::shared_ptr<MemoryStream> MapFile(const std::string& path);
+
+            const std::shared_ptr<const uint8_t>& GetData() const
+            {
+                return m_data;
+            }
+
+            size_t GetByteLength() const
+            {
+                return m_byteLength;
+            }
+
+        private:
+            std::shared_ptr<const uint8_t> m_data;
+            size_t m_byteLength;
+
+            MemoryStreamBuffer m_streamBuffer;
+        };
+    }
+}
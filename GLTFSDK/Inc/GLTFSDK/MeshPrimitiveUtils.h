@@ -57,6 +57,24 @@ namespace Microsoft
             std::vector<uint32_t> GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
             std::vector<uint32_t> GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
 
+            // Overloads that write into caller-provided memory (e.g. a mapped upload buffer) rather than returning a new
+            // vector, applying the same conversions. count is the capacity of data and must be at least the size of the
+            // vector the corresponding overload above would return. Returns the number of values written.
+            size_t GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint16_t* data, size_t count);
+            size_t GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count);
+
+            size_t GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t count);
+            size_t GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t count);
+            size_t GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t count);
+            size_t GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t count);
+
+            size_t GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t count);
+            size_t GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count);
+
+            size_t GetJointIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count);
+            size_t GetJointIndices64(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint64_t* data, size_t count);
+            size_t GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count);
+
             std::vector<uint16_t> ReverseTriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode);
             std::vector<uint32_t> ReverseTriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode);
 
@@ -107,65 +107,10 @@ namespace Microsoft
             return decodeTable;
         }
 
-        inline void Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip)
-        {
-            if (encodedData.GetByteCount() != (decodedData.bufferByteLength + bytesToSkip))
-            {
-                throw GLTFException("The specified decode buffer's size is incorrect");
-            }
-
-            static const std::vector<uint8_t> decodeTable = GetDecodeTable();
-
-            uint32_t block = 0U;
-            uint32_t blockBits = 0U;
-
-            uint8_t* decodedBytePtr = static_cast<uint8_t*>(decodedData.buffer);
-
-            for (const auto encodedChar : encodedData)
-            {
-                // For platforms where char is unsigned (encodedChar < 0) results in a tautology warning.
-                // Only do that test on platforms where char is signed.
-                if ((std::numeric_limits<char>::is_signed && (static_cast<signed char>(encodedChar) < 0)) || (static_cast<size_t>(encodedChar) >= decodeTable.size()))
-                {
-                    throw GLTFException("Invalid base64 character");
-                }
-
-                const auto decodedChar = decodeTable[encodedChar];
-
-                if (decodedChar == std::numeric_limits<uint8_t>::max())
-                {
-                    throw GLTFException("Invalid base64 character");
-                }
-
-                // Each character of a base64 string encodes 6 bits of data so left shift any remaining
-                // bits to accomodate another character's worth of data before performing a bitwise OR
-                block <<= 6U;
-                block |= decodedChar & 0x3F;
-
-                // Keep track of how many bits of the 'block' variable are currently used
-                blockBits += 6U;
-
-                // If there are 8 or more bits stored in 'block' then write a single byte to the output buffer
-                if (blockBits >= 8U)
-                {
-                    blockBits -= 8U;
-
-                    if (bytesToSkip > 0)
-                    {
-                        bytesToSkip--;
-                    }
-                    else
-                    {
-                        // Right shift the decoded data stored in 'block' so that the byte of
-                        // data to be written to the output buffer occupies the low-order byte
-                        *(decodedBytePtr++) = (block >> blockBits) & 0xFF;
-                    }
-
-                    // Generate a bitmask that discards only the byte just written to the output buffer during the bitwise AND
-                    block &= (1 << blockBits) - 1;
-                }
-            }
-        }
+        // Decodes the base64 encoded data into the specified buffer, discarding the first bytesToSkip decoded bytes. The
+        // buffer's size plus bytesToSkip must equal the decoded size of the data. Vectorized (SSSE3/AVX2 or NEON) decoders
+        // are used when supported by the processor, selected at runtime, with a table driven scalar fallback.
+        void Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip);
 
         inline std::vector<uint8_t> Base64Decode(const Base64StringView& encodedData)
         {
@@ -182,6 +127,26 @@ namespace Microsoft
             return Base64Decode(Base64StringView(encodedData));
         }
 
+        // Encodes binary data as a base64 string, including '=' padding characters
+        std::string Base64Encode(const void* data, size_t byteLength);
+
+        inline std::string Base64Encode(const std::vector<uint8_t>& data)
+        {
+            return Base64Encode(data.data(), data.size());
+        }
+
+        // A half-open range [byteBegin, byteEnd) of a buffer's bytes
+        struct ByteRange
+        {
+            size_t byteBegin;
+            size_t byteEnd;
+        };
+
+        // Plans the reads needed to cover a set of byte ranges: the ranges are sorted and any that overlap, are adjacent
+        // or are separated by a gap of at most maxGapByteLength bytes are merged. Each input range is contained by exactly
+        // one of the returned ranges, which are in increasing order and don't overlap.
+        std::vector<ByteRange> CoalesceByteRanges(std::vector<ByteRange> ranges, size_t maxGapByteLength);
+
         inline bool IsUriBase64(const std::string& uri, std::string::const_iterator& itBegin, std::string::const_iterator& itEnd)
         {
             // A valid base64 data URI must begin with "data:"
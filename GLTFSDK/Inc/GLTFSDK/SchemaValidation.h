@@ -1,9 +1,15 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#pragma once
+
 #include <GLTFSDK/RapidJsonUtils.h>
+#include <GLTFSDK/Schema.h>
 
 #include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
 
 namespace Microsoft
 {
@@ -16,6 +22,79 @@ namespace Microsoft
             virtual const char* GetSchemaContent(const std::string& uri) const = 0;
         };
 
+        // Parses the schema documents located by an ISchemaLocator on first use, including any schemas they reference
+        class SchemaDocumentProvider : public rapidjson::IRemoteSchemaDocumentProvider
+        {
+        public:
+            explicit SchemaDocumentProvider(std::unique_ptr<const ISchemaLocator> schemaLocator);
+
+            // Returns the schema document at uri, throws a GLTFException if it can't be located or isn't valid JSON
+            const rapidjson::SchemaDocument& GetSchemaDocument(const std::string& uri);
+
+            const rapidjson::SchemaDocument* GetRemoteDocument(const char* uri, rapidjson::SizeType length) override;
+
+        private:
+            const std::unique_ptr<const ISchemaLocator> m_schemaLocator;
+
+            std::unordered_map<std::string, rapidjson::SchemaDocument> m_schemaDocuments;
+        };
+
+        // Throws a ValidationException that describes the first schema violation found by the validator
+        template<typename TSchemaValidator>
+        [[noreturn]] void ThrowSchemaViolation(const TSchemaValidator& schemaValidator)
+        {
+            rapidjson::StringBuffer sb;
+
+            const std::string schemaKeyword = schemaValidator.GetInvalidSchemaKeyword();
+            schemaValidator.GetInvalidDocumentPointer().StringifyUriFragment(sb);
+            const std::string schemaInvalid = sb.GetString();
+
+            throw ValidationException("Schema violation at " + schemaInvalid + " due to " + schemaKeyword);
+        }
+
         void ValidateDocumentAgainstSchema(const rapidjson::Document& d, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator);
+
+        // A schema compiled once, together with every schema it references, so that it can be reused to validate any
+        // number of documents. Compiling the glTF schema costs more than parsing a typical small asset. A compiled schema
+        // is immutable so it may be used by several threads at once.
+        class CompiledSchema
+        {
+        public:
+            CompiledSchema(std::unique_ptr<const ISchemaLocator> schemaLocator, const std::string& schemaUri = SCHEMA_URI_GLTF);
+
+            CompiledSchema(const CompiledSchema&) = delete;
+            CompiledSchema& operator=(const CompiledSchema&) = delete;
+
+            const rapidjson::SchemaDocument& GetSchemaDocument() const
+            {
+                return m_schemaDocument;
+            }
+
+            // Throws a ValidationException if the document doesn't conform to the schema
+            void Validate(const rapidjson::Document& document) const;
+
+        private:
+            SchemaDocumentProvider m_provider;// Owns the schema document and the schemas it references
+            const rapidjson::SchemaDocument& m_schemaDocument;
+        };
+
+        // The glTF schema compiled with the default schema locator, keyed by SchemaFlags. Each set of flags is compiled on
+        // first use. All member functions are thread-safe.
+        class SchemaCache
+        {
+        public:
+            // A cache shared by the whole process, used by the Deserialize overloads that take SchemaFlags
+            static const std::shared_ptr<SchemaCache>& GetProcessCache();
+
+            std::shared_ptr<const CompiledSchema> Get(SchemaFlags schemaFlags);
+
+            size_t Size() const;
+            void Clear();
+
+        private:
+            std::unordered_map<std::underlying_type_t<SchemaFlags>, std::shared_ptr<const CompiledSchema>> m_schemas;
+
+            mutable std::mutex m_mutex;
+        };
     }
 }
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ByteBudgetCache.h>
+#include <GLTFSDK/IStreamReader.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Identifies the version of a file that was read. A change to either the size or the modification time of a
+        // file invalidates any data cached for it.
+        struct FileIdentity
+        {
+            uint64_t byteCount;
+            int64_t modifiedTime;// An opaque, platform specific timestamp that is only compared for equality
+
+            bool operator==(const FileIdentity& other) const
+            {
+                return byteCount == other.byteCount && modifiedTime == other.modifiedTime;
+            }
+
+            bool operator!=(const FileIdentity& other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        typedef CacheStats SharedResourceCacheStats;
+
+        // Caches the contents of files so they are only read once by any number of readers, e.g. when converting many
+        // documents that reference the same buffers and textures. Entries are keyed by the file's resolved (absolute)
+        // path and validated against its identity on every lookup. The least recently used files are evicted when the
+        // total size would exceed the byte budget, files larger than the budget are read but never cached.
+        //
+        // Note: the returned data is read-only and reference counted, evicted data stays alive while any references
+        // remain. All member functions are thread-safe, the lock isn't held while a file is being read so two threads
+        // that miss at once may both read the same file (only one copy is cached).
+        class SharedResourceCache
+        {
+        public:
+            explicit SharedResourceCache(size_t byteBudget);
+
+            // A cache shared by the whole process, created with DefaultByteBudget on first use
+            static const std::shared_ptr<SharedResourceCache>& GetProcessCache();
+
+            static constexpr size_t DefaultByteBudget = 1024U * 1024U * 1024U;
+
+            // Returns the contents of the file, reading and caching them if the file isn't cached or has changed
+            std::shared_ptr<const std::vector<uint8_t>> Get(const std::string& path);
+
+            // Evicts the least recently used files if the cached data exceeds the new budget
+            void SetByteBudget(size_t byteBudget);
+            size_t GetByteBudget() const;
+
+            // The total size of the files currently held by the cache
+            size_t GetByteCount() const;
+
+            SharedResourceCacheStats GetStats() const;
+
+            size_t Size() const;
+            void Clear();
+
+            static std::string ResolvePath(const std::string& path);
+            static FileIdentity GetFileIdentity(const std::string& resolvedPath);
+
+        private:
+            struct CachedFile
+            {
+                FileIdentity identity;
+                std::shared_ptr<const std::vector<uint8_t>> data;
+            };
+
+            std::shared_ptr<const std::vector<uint8_t>> Find(const std::string& path, const FileIdentity& identity);
+
+            ByteBudgetCache<CachedFile> m_cache;
+
+            mutable std::mutex m_mutex;
+        };
+
+        // An IStreamReader that resolves uris relative to baseDirectory and returns MemoryStreams over the files' data in
+        // a SharedResourceCache. A GLTFResourceReader reads directly from a MemoryStream's memory, so readers of different
+        // documents share one copy of each file.
+        class SharedResourceStreamReader : public IStreamReader
+        {
+        public:
+            explicit SharedResourceStreamReader(std::string baseDirectory = {}, std::shared_ptr<SharedResourceCache> cache = SharedResourceCache::GetProcessCache());
+
+            std::shared_ptr<std::istream> GetInputStream(const std::string& uri) const override;
+
+            const std::shared_ptr<SharedResourceCache>& GetCache() const
+            {
+                return m_cache;
+            }
+
+        private:
+            std::string m_baseDirectory;
+            std::shared_ptr<SharedResourceCache> m_cache;
+        };
+    }
+}
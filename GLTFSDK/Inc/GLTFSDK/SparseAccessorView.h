@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/AccessorView.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // The data of a sparse accessor without expanding it to accessor.count elements: the base data (or none, when the
+        // accessor has no buffer view and its base is implicitly all zeros), plus the indices of the elements that the
+        // sparse values replace, in increasing order, and those values. The base and values views point directly into
+        // the buffer's memory when possible, as for GLTFResourceReader::ReadBinaryDataView.
+        template<typename T>
+        class SparseAccessorView
+        {
+        public:
+            SparseAccessorView()
+                : m_count(0U),
+                m_typeCount(0U)
+            {
+            }
+
+            SparseAccessorView(AccessorView<T> base, size_t count, size_t typeCount, std::vector<uint32_t> indices, AccessorView<T> values)
+                : m_base(std::move(base)),
+                m_count(count),
+                m_typeCount(typeCount),
+                m_indices(std::move(indices)),
+                m_values(std::move(values))
+            {
+            }
+
+            // The number of elements in the accessor, i.e. the size of the expanded data in elements
+            size_t GetCount() const
+            {
+                return m_count;
+            }
+
+            size_t GetTypeCount() const
+            {
+                return m_typeCount;
+            }
+
+            // True when the accessor has no buffer view, so every element not given by the sparse values is zero
+            bool IsBaseZero() const
+            {
+                return m_base.IsEmpty();
+            }
+
+            const AccessorView<T>& GetBase() const
+            {
+                return m_base;
+            }
+
+            const std::vector<uint32_t>& GetIndices() const
+            {
+                return m_indices;
+            }
+
+            // The sparse values, where GetValues()[i] replaces element GetIndices()[i]
+            const AccessorView<T>& GetValues() const
+            {
+                return m_values;
+            }
+
+            // Returns the value of one component of an element, searching the sparse indices before falling back to the base
+            T Get(size_t index, size_t component) const
+            {
+                auto it = std::lower_bound(m_indices.begin(), m_indices.end(), index);
+
+                if (it != m_indices.end() && *it == index)
+                {
+                    return m_values.Get(static_cast<size_t>(it - m_indices.begin()), component);
+                }
+
+                return IsBaseZero() ? T() : m_base.Get(index, component);
+            }
+
+            // Expands the data to GetCount() * GetTypeCount() components
+            std::vector<T> ToVector() const
+            {
+                std::vector<T> result = IsBaseZero() ? std::vector<T>(m_count * m_typeCount) : m_base.ToVector();
+
+                for (size_t i = 0U; i < m_indices.size(); ++i)
+                {
+                    std::copy_n(m_values.GetElement(i), m_typeCount, result.data() + m_indices[i] * m_typeCount);
+                }
+
+                return result;
+            }
+
+        private:
+            AccessorView<T> m_base;
+
+            size_t m_count;
+            size_t m_typeCount;
+
+            std::vector<uint32_t> m_indices;
+            AccessorView<T> m_values;
+        };
+    }
+}
@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ByteBudgetCache.h>
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/IStreamCache.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Returns the size of a string stream's contents without copying them, leaving its position unchanged
+        inline size_t GetStringBufferByteCount(std::stringbuf& buffer, std::ios_base::openmode which)
+        {
+            const auto pos = buffer.pubseekoff(0, std::ios_base::cur, which);
+            const auto end = buffer.pubseekoff(0, std::ios_base::end, which);
+
+            buffer.pubseekpos(pos, which);
+
+            return end < 0 ? 0U : static_cast<size_t>(end);
+        }
+
+        // Returns the number of bytes of memory held by a cached stream or buffer. String streams and MemoryStreams report
+        // the size of their contents, other streams (e.g. file streams) only hold a small fixed size buffer and report zero.
+        inline size_t GetCachedByteCount(const std::shared_ptr<std::istream>& stream)
+        {
+            if (auto memoryStream = dynamic_cast<const MemoryStream*>(stream.get()))
+            {
+                return memoryStream->GetByteLength();
+            }
+
+            if (auto stringBuffer = stream ? dynamic_cast<std::stringbuf*>(stream->rdbuf()) : nullptr)
+            {
+                return GetStringBufferByteCount(*stringBuffer, std::ios_base::in);
+            }
+
+            return 0U;
+        }
+
+        inline size_t GetCachedByteCount(const std::shared_ptr<std::ostream>& stream)
+        {
+            if (auto stringBuffer = stream ? dynamic_cast<std::stringbuf*>(stream->rdbuf()) : nullptr)
+            {
+                return GetStringBufferByteCount(*stringBuffer, std::ios_base::out);
+            }
+
+            return 0U;
+        }
+
+        template<typename T>
+        size_t GetCachedByteCount(const std::shared_ptr<const std::vector<T>>& data)
+        {
+            return data ? data->size() * sizeof(T) : 0U;
+        }
+
+        typedef CacheStats StreamCacheStats;
+
+        // A 'Least Recently Used' (LRU) cache that evicts entries to keep the total number of bytes held by its streams (or
+        // buffers) within a byte budget, rather than limiting the number of entries. The size of each entry is measured by
+        // the byte count functor when it is added and measured again whenever it is returned by Get, every entry is
+        // measured again before a new entry is added. A stream that grows after it's returned (e.g. a writer stream) is
+        // therefore counted, and the budget enforced, on the next call to Get or Set, or straight away by calling
+        // UpdateByteCount. An entry larger than the budget is returned to the caller but not cached. As streams such as
+        // file streams count as zero bytes the number of entries can be limited as well.
+        //
+        // Note: an evicted stream stays alive while the caller holds a reference to it. Like StreamCacheLRU this class is
+        // not thread-safe.
+        template<typename TStream>
+        class StreamCacheByteBudget : public IStreamCache<TStream>
+        {
+        public:
+            typedef typename ByteBudgetCache<TStream>::ByteCountFn ByteCountFn;
+
+            template<typename Fn>
+            StreamCacheByteBudget(Fn fnGenerate, size_t byteBudget, size_t cacheMaxSize = std::numeric_limits<size_t>::max(),
+                ByteCountFn fnByteCount = [](const TStream& stream) { return GetCachedByteCount(stream); }) :
+                byteBudget(byteBudget),
+                cacheMaxSize(cacheMaxSize),
+                m_cache(byteBudget, std::move(fnByteCount), cacheMaxSize),
+                m_cacheFn(fnGenerate)
+            {
+                if (byteBudget == 0U)
+                {
+                    throw GLTFException("Stream cache byte budget must be greater than zero");
+                }
+
+                if (cacheMaxSize == 0U)
+                {
+                    throw GLTFException("Stream cache max size must be greater than zero");
+                }
+            }
+
+            TStream Get(const std::string& uri) override
+            {
+                if (auto cached = m_cache.Find(uri))
+                {
+                    m_cache.RecordHit();
+
+                    TStream stream = *cached;
+
+                    m_cache.UpdateByteCount(uri);
+
+                    return stream;
+                }
+
+                m_cache.RecordMiss();
+
+                return Insert(uri, m_cacheFn(uri));
+            }
+
+            TStream Set(const std::string& uri, TStream stream) override
+            {
+                m_cache.Erase(uri);
+
+                return Insert(uri, std::move(stream));
+            }
+
+            void Clear()
+            {
+                m_cache.Clear();
+            }
+
+            size_t Size() const
+            {
+                return m_cache.Size();
+            }
+
+            // Measures the size of a cached entry again, e.g. once a writer stream has been written to, and evicts entries
+            // if the cache now exceeds the budget. Does nothing if the uri isn't cached.
+            void UpdateByteCount(const std::string& uri)
+            {
+                m_cache.UpdateByteCount(uri);
+            }
+
+            // The total number of bytes held by the cached entries when they were last measured. It never exceeds
+            // byteBudget, though entries may have grown since (see UpdateByteCount).
+            size_t GetByteCount() const
+            {
+                return m_cache.GetByteCount();
+            }
+
+            const StreamCacheStats& GetStats() const
+            {
+                return m_cache.GetStats();
+            }
+
+            const size_t byteBudget;
+            const size_t cacheMaxSize;
+
+        private:
+            TStream Insert(const std::string& uri, TStream stream)
+            {
+                // Cached streams may have grown since they were last measured
+                m_cache.UpdateByteCounts();
+                m_cache.Insert(uri, stream);
+
+                return stream;
+            }
+
+            ByteBudgetCache<TStream> m_cache;
+
+            std::function<TStream(const std::string&)> m_cacheFn;
+        };
+
+        typedef StreamCacheByteBudget<std::shared_ptr<std::istream>> StreamReaderCacheByteBudget;
+        typedef StreamCacheByteBudget<std::shared_ptr<std::ostream>> StreamWriterCacheByteBudget;
+    }
+}
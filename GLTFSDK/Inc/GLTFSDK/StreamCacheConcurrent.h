@@ -0,0 +1,199 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/IStreamCache.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A thread-safe cache shared by all threads. Uris are spread across shards by hash, each with its own lock, so
+        // threads resolving different resources rarely contend. Hits only take a shard's lock in shared mode and mark the
+        // entry as referenced, while eviction uses the CLOCK approximation of LRU: the shard's hand sweeps over the entries,
+        // clearing referenced flags, and replaces the first entry that hasn't been referenced since the last sweep. Each
+        // shard holds up to cacheMaxSize / shardCount entries (rounded up). The user supplied functor may be called
+        // concurrently from different threads, and more than once for the same uri if several threads miss at once.
+        //
+        // Note: unlike StreamCacheThreadLocal the cached streams themselves are shared, so threads must not use the same
+        // stream (or its read position) at the same time. Use StreamCacheThreadLocal for concurrent GLTFResourceReader reads.
+        template<typename TStream>
+        class StreamCacheConcurrent : public IStreamCache<TStream>
+        {
+        public:
+            template<typename Fn>
+            StreamCacheConcurrent(Fn fnGenerate, size_t cacheMaxSize = std::numeric_limits<size_t>::max(), size_t shardCount = 16U) :
+                cacheMaxSize(cacheMaxSize),
+                m_shardCount(shardCount),
+                m_shardMaxSize(cacheMaxSize / std::max<size_t>(shardCount, 1U) + (cacheMaxSize % std::max<size_t>(shardCount, 1U) ? 1U : 0U)),
+                m_shards(new Shard[shardCount]),
+                m_cacheFn(fnGenerate)
+            {
+                if (cacheMaxSize == 0U)
+                {
+                    throw GLTFException("Concurrent max cache size must be greater than zero");
+                }
+
+                if (shardCount == 0U)
+                {
+                    throw GLTFException("Concurrent cache shard count must be greater than zero");
+                }
+            }
+
+            TStream Get(const std::string& uri) override
+            {
+                Shard& shard = GetShard(uri);
+
+                {
+                    std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+
+                    auto it = shard.indices.find(uri);
+
+                    if (it != shard.indices.end())
+                    {
+                        Slot& slot = shard.slots[it->second];
+                        slot.isReferenced.store(true, std::memory_order_relaxed);
+                        return slot.stream;
+                    }
+                }
+
+                // Generate the stream without holding the lock, another thread may cache a stream for the same uri first
+                TStream stream = m_cacheFn(uri);
+
+                std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+
+                auto it = shard.indices.find(uri);
+
+                if (it != shard.indices.end())
+                {
+                    return shard.slots[it->second].stream;
+                }
+
+                return Insert(shard, uri, std::move(stream));
+            }
+
+            TStream Set(const std::string& uri, TStream stream) override
+            {
+                Shard& shard = GetShard(uri);
+
+                std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+
+                auto it = shard.indices.find(uri);
+
+                if (it != shard.indices.end())
+                {
+                    Slot& slot = shard.slots[it->second];
+                    slot.isReferenced.store(true, std::memory_order_relaxed);
+                    return slot.stream = std::move(stream);
+                }
+
+                return Insert(shard, uri, std::move(stream));
+            }
+
+            size_t Size() const
+            {
+                size_t size = 0U;
+
+                for (size_t i = 0U; i < m_shardCount; ++i)
+                {
+                    std::shared_lock<std::shared_timed_mutex> lock(m_shards[i].mutex);
+                    size += m_shards[i].indices.size();
+                }
+
+                return size;
+            }
+
+            size_t GetShardCount() const
+            {
+                return m_shardCount;
+            }
+
+            const size_t cacheMaxSize;
+
+        private:
+            struct Slot
+            {
+                std::string uri;
+                TStream stream;
+                std::atomic<bool> isReferenced;
+            };
+
+            struct Shard
+            {
+                Shard() : hand(0U)
+                {
+                }
+
+                mutable std::shared_timed_mutex mutex;
+
+                std::unordered_map<std::string, size_t> indices;
+                std::deque<Slot> slots;// A deque so that growing it never moves the existing slots (and their atomics)
+
+                size_t hand;
+            };
+
+            Shard& GetShard(const std::string& uri) const
+            {
+                return m_shards[std::hash<std::string>()(uri) % m_shardCount];
+            }
+
+            // Must be called with the shard's lock held exclusively
+            TStream Insert(Shard& shard, const std::string& uri, TStream stream)
+            {
+                if (shard.slots.size() < m_shardMaxSize)
+                {
+                    shard.slots.emplace_back();
+
+                    Slot& slot = shard.slots.back();
+                    slot.uri = uri;
+                    slot.stream = std::move(stream);
+                    slot.isReferenced.store(false, std::memory_order_relaxed);
+
+                    shard.indices[uri] = shard.slots.size() - 1U;
+
+                    return slot.stream;
+                }
+
+                // Sweep the hand round, giving referenced entries a second chance, until an entry can be replaced
+                while (shard.slots[shard.hand].isReferenced.exchange(false, std::memory_order_relaxed))
+                {
+                    shard.hand = (shard.hand + 1U) % shard.slots.size();
+                }
+
+                const size_t index = shard.hand;
+                shard.hand = (shard.hand + 1U) % shard.slots.size();
+
+                Slot& slot = shard.slots[index];
+
+                shard.indices.erase(slot.uri);
+                shard.indices[uri] = index;
+
+                slot.uri = uri;
+                slot.stream = std::move(stream);
+
+                return slot.stream;
+            }
+
+            const size_t m_shardCount;
+            const size_t m_shardMaxSize;
+
+            std::unique_ptr<Shard[]> m_shards;
+
+            std::function<TStream(const std::string&)> m_cacheFn;
+        };
+
+        typedef StreamCacheConcurrent<std::shared_ptr<std::istream>> StreamReaderCacheConcurrent;
+        typedef StreamCacheConcurrent<std::shared_ptr<std::ostream>> StreamWriterCacheConcurrent;
+    }
+}
@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/StreamCacheLRU.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Gives each thread its own set of cached streams (each thread's set is a StreamCacheLRU of the specified maximum
+        // size) so that threads never share a stream, or its read position. This allows a GLTFResourceReader to be used
+        // from several threads at once. The user supplied functor may be called concurrently from different threads.
+        //
+        // Note: Set only populates the calling thread's cache. A thread's streams (e.g. open files) are kept until the thread
+        // calls ReleaseThreadCache or the StreamCacheThreadLocal is destroyed, so short-lived threads should release their
+        // cache before they exit.
+        template<typename TStream>
+        class StreamCacheThreadLocal : public IStreamCache<TStream>
+        {
+        public:
+            template<typename Fn>
+            StreamCacheThreadLocal(Fn fnGenerate, size_t cacheMaxSize = 16U) :
+                cacheMaxSize(cacheMaxSize),
+                m_id(NextId()),
+                m_cacheFn(fnGenerate)
+            {
+                if (cacheMaxSize == 0U)
+                {
+                    throw GLTFException("Thread local max cache size must be greater than zero");
+                }
+            }
+
+            TStream Get(const std::string& uri) override
+            {
+                return GetThreadCache().Get(uri);
+            }
+
+            TStream Set(const std::string& uri, TStream stream) override
+            {
+                return GetThreadCache().Set(uri, std::move(stream));
+            }
+
+            // Discards the calling thread's cache and its streams. The thread is given a new cache if it calls Get or Set again.
+            void ReleaseThreadCache()
+            {
+                auto& lastThreadCache = GetLastThreadCache();
+
+                if (lastThreadCache.id == m_id)
+                {
+                    lastThreadCache = { 0U, nullptr };
+                }
+
+                std::unique_ptr<ThreadCache> threadCache;
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    auto it = m_threadCaches.find(std::this_thread::get_id());
+
+                    if (it != m_threadCaches.end())
+                    {
+                        threadCache = std::move(it->second);
+                        m_threadCaches.erase(it);
+                    }
+                }
+            }
+
+            // The number of threads that currently have a cache
+            size_t GetThreadCount() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_threadCaches.size();
+            }
+
+            const size_t cacheMaxSize;
+
+        private:
+            typedef StreamCacheLRU<TStream> ThreadCache;
+
+            // Each thread remembers the cache it used last so that the lock is only taken when a thread first uses an
+            // instance, or switches between instances. Ids are never reused so a stale entry can't match a new instance.
+            struct LastThreadCache
+            {
+                uint64_t id;
+                ThreadCache* cache;
+            };
+
+            static LastThreadCache& GetLastThreadCache()
+            {
+                static thread_local LastThreadCache lastThreadCache = { 0U, nullptr };
+                return lastThreadCache;
+            }
+
+            ThreadCache& GetThreadCache()
+            {
+                auto& lastThreadCache = GetLastThreadCache();
+
+                if (lastThreadCache.id != m_id)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    auto& threadCache = m_threadCaches[std::this_thread::get_id()];
+
+                    if (!threadCache)
+                    {
+                        threadCache = std::make_unique<ThreadCache>(m_cacheFn, cacheMaxSize);
+                    }
+
+                    lastThreadCache = { m_id, threadCache.get() };
+                }
+
+                return *lastThreadCache.cache;
+            }
+
+            static uint64_t NextId()
+            {
+                static std::atomic<uint64_t> nextId(1U);
+                return nextId++;
+            }
+
+            const uint64_t m_id;
+
+            std::function<TStream(const std::string&)> m_cacheFn;
+
+            mutable std::mutex m_mutex;
+            std::unordered_map<std::thread::id, std::unique_ptr<ThreadCache>> m_threadCaches;
+        };
+
+        typedef StreamCacheThreadLocal<std::shared_ptr<std::istream>> StreamReaderCacheThreadLocal;
+        typedef StreamCacheThreadLocal<std::shared_ptr<std::ostream>> StreamWriterCacheThreadLocal;
+    }
+}
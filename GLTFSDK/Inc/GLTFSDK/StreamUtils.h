@@ -5,6 +5,7 @@
 
 #include <istream>
 #include <ostream>
+#include <vector>
 
 namespace Microsoft
 {
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/IExecutor.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Runs tasks in the order they are issued on a fixed number of worker threads (0 creates one per hardware
+        // thread). The destructor waits for all issued tasks to complete.
+        class ThreadPoolExecutor : public IExecutor
+        {
+        public:
+            explicit ThreadPoolExecutor(size_t threadCount = 0U);
+            ~ThreadPoolExecutor() override;
+
+            ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+            ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+            void Execute(std::function<void()> task) override;
+
+            size_t GetConcurrency() const override;
+
+        private:
+            void Run();
+
+            std::vector<std::thread> m_threads;
+
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<std::function<void()>> m_tasks;
+            bool m_isStopping;
+        };
+    }
+}
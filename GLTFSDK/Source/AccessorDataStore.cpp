@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/AccessorDataStore.h>
+
+#include <unordered_set>
+
+using namespace Microsoft::glTF;
+
+AccessorDataStore::AccessorDataStore(const Document& document, const GLTFResourceReader& reader, size_t byteBudget) :
+    m_document(document),
+    m_reader(reader),
+    m_cache(byteBudget, [](const AccessorData& data) { return data.GetByteLength(); })
+{
+}
+
+AccessorData AccessorDataStore::Get(const std::string& accessorId)
+{
+    std::promise<AccessorData> promise;
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (auto data = m_cache.Find(accessorId))
+        {
+            m_cache.RecordHit();
+            return *data;
+        }
+
+        // Another call is already decoding the accessor so wait for its result rather than decoding it again
+        auto itPending = m_pending.find(accessorId);
+
+        if (itPending != m_pending.end())
+        {
+            auto future = itPending->second;
+
+            m_cache.RecordHit();
+            lock.unlock();
+
+            return future.get();
+        }
+
+        m_cache.RecordMiss();
+        m_pending.emplace(accessorId, promise.get_future().share());
+    }
+
+    AccessorData data;
+
+    try
+    {
+        data = m_reader.ReadBinaryDataBatch(m_document, { accessorId }, 1U).front();
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.erase(accessorId);
+        }
+
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending.erase(accessorId);
+        m_cache.Insert(accessorId, data);
+    }
+
+    promise.set_value(data);
+
+    return data;
+}
+
+void AccessorDataStore::Prefetch(const std::vector<std::string>& accessorIds, size_t threadCount)
+{
+    std::vector<std::string> missingIds;
+    std::vector<std::promise<AccessorData>> promises;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::unordered_set<std::string> uniqueIds;
+
+        for (const auto& accessorId : accessorIds)
+        {
+            if (!uniqueIds.insert(accessorId).second || m_cache.Contains(accessorId) || m_pending.count(accessorId))
+            {
+                continue;
+            }
+
+            missingIds.push_back(accessorId);
+        }
+
+        promises.resize(missingIds.size());
+
+        for (size_t i = 0U; i < missingIds.size(); ++i)
+        {
+            m_pending.emplace(missingIds[i], promises[i].get_future().share());
+        }
+
+        m_cache.RecordMiss(missingIds.size());
+    }
+
+    if (missingIds.empty())
+    {
+        return;
+    }
+
+    std::vector<AccessorData> results;
+
+    try
+    {
+        results = m_reader.ReadBinaryDataBatch(m_document, missingIds, threadCount);
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            for (const auto& accessorId : missingIds)
+            {
+                m_pending.erase(accessorId);
+            }
+        }
+
+        for (auto& promise : promises)
+        {
+            promise.set_exception(std::current_exception());
+        }
+
+        throw;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (size_t i = 0U; i < missingIds.size(); ++i)
+        {
+            m_pending.erase(missingIds[i]);
+            m_cache.Insert(missingIds[i], results[i]);
+        }
+    }
+
+    for (size_t i = 0U; i < promises.size(); ++i)
+    {
+        promises[i].set_value(results[i]);
+    }
+}
+
+void AccessorDataStore::SetByteBudget(size_t byteBudget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.SetByteBudget(byteBudget);
+}
+
+size_t AccessorDataStore::GetByteBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.GetByteBudget();
+}
+
+size_t AccessorDataStore::GetByteCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.GetByteCount();
+}
+
+AccessorDataStoreStats AccessorDataStore::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.GetStats();
+}
+
+bool AccessorDataStore::Contains(const std::string& accessorId) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.Contains(accessorId);
+}
+
+void AccessorDataStore::Erase(const std::string& accessorId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.Erase(accessorId);
+}
+
+size_t AccessorDataStore::Size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.Size();
+}
+
+void AccessorDataStore::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.Clear();
+}
@@ -6,16 +6,31 @@
 #include <GLTFSDK/Constants.h>
 #include <GLTFSDK/ExtensionHandlers.h>
 #include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/IExecutor.h>
 #include <GLTFSDK/RapidJsonUtils.h>
 #include <GLTFSDK/Serialize.h>
 #include <GLTFSDK/SchemaValidation.h>
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <sstream>
+#include <utility>
+#include <unordered_map>
 
 using namespace Microsoft::glTF;
 
 namespace
 {
+    // Parse failures are reported to this stream before the exception is rethrown. The ParallelDeserializer points it at
+    // a buffer in each of its tasks so that only the first failure is printed, and on the calling thread.
+    std::ostream*& GetDiagnosticStream()
+    {
+        static thread_local std::ostream* diagnosticStream = &std::cerr;
+        return diagnosticStream;
+    }
+
     void ParseExtensions(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer)
     {
         const auto& extensionsIt = v.FindMember("extensions");
@@ -63,6 +78,47 @@ namespace
         ParseProperty(v, textureInfo, extensionDeserializer);
     }
 
+    template<typename T>
+    T ParseIndexedContainerItem(
+        const char* name,
+        size_t index,
+        const rapidjson::Value& value,
+        const ExtensionDeserializer& extensionDeserializer,
+        T(*fn)(const rapidjson::Value&, const ExtensionDeserializer&))
+    {
+        try
+        {
+            return fn(value, extensionDeserializer);
+        }
+        catch (const InvalidGLTFException& e)
+        {
+            *GetDiagnosticStream() << "Could not parse " << name << "[" << index << "]: " << e.what() << "\n";
+            throw;
+        }
+    }
+
+    template<typename T>
+    void AppendIndexedContainerItem(IndexedContainer<const T>& items, T&& item, size_t index)
+    {
+        const auto& itemId = items.Append(std::move(item), AppendIdPolicy::GenerateOnEmpty).id;
+
+        (void)itemId;   // To disable unused-variable warnings when assert is compiled away.
+        assert(itemId == std::to_string(index));
+        (void)index;
+    }
+
+    template<typename T>
+    void DeserializeIndexedContainerItem(
+        const char* name,
+        size_t index,
+        const rapidjson::Value& value,
+        IndexedContainer<const T>& items,
+        const ExtensionDeserializer& extensionDeserializer,
+        T(*fn)(const rapidjson::Value&, const ExtensionDeserializer&))
+    {
+        AppendIndexedContainerItem(items, ParseIndexedContainerItem(name, index, value, extensionDeserializer, fn), index);
+    }
+
     template<typename T>
     IndexedContainer<const T> DeserializeToIndexedContainer(
         const char* name,
@@ -79,19 +135,7 @@ namespace
 
             for (auto& valueArray : it->value.GetArray())
             {
-                try
-                {
-                    const auto& item = items.Append(fn(valueArray, extensionDeserializer), AppendIdPolicy::GenerateOnEmpty);
-                    const auto& itemId = item.id;
-
-                    (void)itemId;   // To disable unused-variable warnings when assert is compiled away.
-                    assert(itemId == std::to_string(index));
-                }
-                catch (const InvalidGLTFException& e)
-                {
-                    std::cerr << "Could not parse " << name << "[" << index << "]: " << e.what() << "\n";
-                    throw;
-                }
+                DeserializeIndexedContainerItem(name, index, valueArray, items, extensionDeserializer, fn);
 
                 ++index;
             }
@@ -546,7 +590,7 @@ namespace
         }
         catch (const InvalidGLTFException& e)
         {
-            std::cerr << "Could not parse animation target\n" << e.what() << "\n";
+            *GetDiagnosticStream() << "Could not parse animation target\n" << e.what() << "\n";
             throw;
         }
     }
@@ -566,7 +610,7 @@ namespace
         }
         catch (const InvalidGLTFException& e)
         {
-            std::cerr << "Could not parse channel\n" << e.what() << "\n";
+            *GetDiagnosticStream() << "Could not parse channel\n" << e.what() << "\n";
             throw;
         }
     }
@@ -627,7 +671,7 @@ namespace
         return skin;
     }
 
-    void ParseExtensionsUsed(const rapidjson::Document& d, Document& gltfDocument)
+    void ParseExtensionsUsed(const rapidjson::Value& d, Document& gltfDocument)
     {
         rapidjson::Value::ConstMemberIterator it;
         if (TryFindMember("extensionsUsed", d, it))
@@ -640,7 +684,7 @@ namespace
         }
     }
 
-    void ParseExtensionsRequired(const rapidjson::Document& d, Document& gltfDocument)
+    void ParseExtensionsRequired(const rapidjson::Value& d, Document& gltfDocument)
     {
         rapidjson::Value::ConstMemberIterator it;
         if (TryFindMember("extensionsRequired", d, it))
@@ -789,18 +833,31 @@ namespace
         return image;
     }
 
-    Document DeserializeInternal(const rapidjson::Document& document, const ExtensionDeserializer& extensionDeserializer, SchemaFlags schemaFlags)
+    // Parses the root object's members other than the top-level arrays of glTF properties
+    void ParseRootMembers(const rapidjson::Value& document, Document& gltfDocument, const ExtensionDeserializer& extensionDeserializer)
     {
-        ValidateDocumentAgainstSchema(document, SCHEMA_URI_GLTF, GetDefaultSchemaLocator(schemaFlags));
-
-        Document gltfDocument;
-
         rapidjson::Value::ConstMemberIterator it;
         if (TryFindMember("asset", document, it))
         {
             gltfDocument.asset = ParseAsset(it->value, extensionDeserializer);
         }
 
+        ParseProperty(document, gltfDocument, extensionDeserializer);
+
+        if (TryFindMember("scene", document, it))
+        {
+            gltfDocument.defaultSceneId = std::to_string(it->value.GetUint());
+        }
+
+        ParseExtensionsUsed(document, gltfDocument);
+        ParseExtensionsRequired(document, gltfDocument);
+    }
+
+    // Builds a Document from a DOM that has already been validated against the schema
+    Document DeserializeInternal(const rapidjson::Document& document, const ExtensionDeserializer& extensionDeserializer)
+    {
+        Document gltfDocument;
+
         gltfDocument.accessors   = DeserializeToIndexedContainer<Accessor>("accessors", document, extensionDeserializer, ParseAccessor);
         gltfDocument.animations  = DeserializeToIndexedContainer<Animation>("animations", document, extensionDeserializer, ParseAnimation);
         gltfDocument.buffers     = DeserializeToIndexedContainer<Buffer>("buffers", document, extensionDeserializer, ParseBuffer);
@@ -815,23 +872,595 @@ namespace
         gltfDocument.skins       = DeserializeToIndexedContainer<Skin>("skins", document, extensionDeserializer, ParseSkin);
         gltfDocument.textures    = DeserializeToIndexedContainer<Texture>("textures", document, extensionDeserializer, ParseTexture);
 
-        ParseProperty(document, gltfDocument, extensionDeserializer);
+        ParseRootMembers(document, gltfDocument, extensionDeserializer);
 
-        if (TryFindMember("scene", document, it))
+        return gltfDocument;
+    }
+
+    // Parses the elements of the top-level arrays on an executor's threads. Each array is split into ranges of up to
+    // ParallelRangeSize elements and every range is parsed by a separate task into its own slots. The parsed elements are
+    // then appended to the Document's containers in order on the calling thread, so the result is the same as that of
+    // DeserializeInternal. If any element fails to parse, the exception thrown, and the only failure printed, is the one
+    // the serial parse would have thrown first.
+    class ParallelDeserializer
+    {
+    public:
+        static constexpr size_t ParallelRangeSize = 256U;
+
+        ParallelDeserializer(const rapidjson::Value& document, const ExtensionDeserializer& extensionDeserializer) :
+            m_document(document),
+            m_extensionDeserializer(extensionDeserializer)
         {
-            gltfDocument.defaultSceneId = std::to_string(it->value.GetUint());
         }
 
-        ParseExtensionsUsed(document, gltfDocument);
-        ParseExtensionsRequired(document, gltfDocument);
+        Document Deserialize(IExecutor& executor)
+        {
+            Document gltfDocument;
+
+            AddCollection("accessors", gltfDocument.accessors, ParseAccessor);
+            AddCollection("animations", gltfDocument.animations, ParseAnimation);
+            AddCollection("buffers", gltfDocument.buffers, ParseBuffer);
+            AddCollection("bufferViews", gltfDocument.bufferViews, ParseBufferView);
+            AddCollection("cameras", gltfDocument.cameras, ParseCamera);
+            AddCollection("images", gltfDocument.images, ParseImage);
+            AddCollection("materials", gltfDocument.materials, ParseMaterial);
+            AddCollection("meshes", gltfDocument.meshes, ParseMesh);
+            AddCollection("nodes", gltfDocument.nodes, ParseNode);
+            AddCollection("samplers", gltfDocument.samplers, ParseSampler);
+            AddCollection("scenes", gltfDocument.scenes, ParseScene);
+            AddCollection("skins", gltfDocument.skins, ParseSkin);
+            AddCollection("textures", gltfDocument.textures, ParseTexture);
+
+            // Exceptions are caught by each range's task so that ParallelFor always parses every range
+            ParallelFor(m_ranges.size(), executor, [this](size_t i)
+            {
+                m_ranges[i]();
+            });
 
-        return gltfDocument;
+            for (const auto& append : m_appends)
+            {
+                append();
+            }
+
+            ParseRootMembers(m_document, gltfDocument, m_extensionDeserializer);
+
+            return gltfDocument;
+        }
+
+    private:
+        template<typename T>
+        void AddCollection(const char* name, IndexedContainer<const T>& items, T(*fn)(const rapidjson::Value&, const ExtensionDeserializer&))
+        {
+            rapidjson::Value::ConstMemberIterator it;
+            if (!TryFindMember(name, m_document, it))
+            {
+                return;
+            }
+
+            const rapidjson::Value& values = it->value;
+            const size_t count = values.Size();
+            const size_t rangeCount = (count + ParallelRangeSize - 1U) / ParallelRangeSize;
+
+            auto results = std::make_shared<std::vector<Optional<T>>>(count);
+            auto failures = std::make_shared<std::vector<Failure>>(rangeCount);
+
+            const ExtensionDeserializer& extensionDeserializer = m_extensionDeserializer;
+
+            for (size_t range = 0U; range < rangeCount; ++range)
+            {
+                m_ranges.push_back([name, fn, range, count, &values, &extensionDeserializer, results, failures]()
+                {
+                    const size_t end = std::min(count, (range + 1U) * ParallelRangeSize);
+
+                    // The failure's report (which names the array and index) is kept with its exception
+                    std::ostringstream diagnostics;
+                    std::ostream* const diagnosticStream = GetDiagnosticStream();
+
+                    GetDiagnosticStream() = &diagnostics;
+
+                    try
+                    {
+                        for (size_t i = range * ParallelRangeSize; i < end; ++i)
+                        {
+                            (*results)[i] = ParseIndexedContainerItem(name, i, values[static_cast<rapidjson::SizeType>(i)], extensionDeserializer, fn);
+                        }
+                    }
+                    catch (...)
+                    {
+                        (*failures)[range] = { std::current_exception(), diagnostics.str() };
+                    }
+
+                    GetDiagnosticStream() = diagnosticStream;
+                });
+            }
+
+            m_appends.push_back([&items, results, failures]()
+            {
+                for (const auto& failure : *failures)
+                {
+                    if (failure.exception)
+                    {
+                        *GetDiagnosticStream() << failure.diagnostics;
+                        std::rethrow_exception(failure.exception);
+                    }
+                }
+
+                for (size_t i = 0U; i < results->size(); ++i)
+                {
+                    AppendIndexedContainerItem(items, std::move((*results)[i].Get()), i);
+                }
+            });
+        }
+
+        struct Failure
+        {
+            std::exception_ptr exception;
+            std::string diagnostics;
+        };
+
+        const rapidjson::Value& m_document;
+        const ExtensionDeserializer& m_extensionDeserializer;
+
+        std::vector<std::function<void()>> m_ranges;
+        std::vector<std::function<void()>> m_appends;// Called in the same order as DeserializeInternal parses the arrays
+    };
+
+    constexpr size_t ParallelDeserializer::ParallelRangeSize;
+
+    // Builds a Document from the JSON reader's events rather than from a rapidjson::Document of the whole JSON. Each
+    // element of the top-level arrays (e.g. a single node) is built into a small DOM, passed to the same Parse function
+    // as DeserializeInternal and then discarded. The root's other members (asset, scene, extensions etc.) are collected
+    // into a separate DOM that's parsed once the end of the JSON is reached.
+    class StreamingHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, StreamingHandler>
+    {
+    public:
+        StreamingHandler(const ExtensionDeserializer& extensionDeserializer) :
+            m_extensionDeserializer(extensionDeserializer),
+            m_collection(nullptr),
+            m_index(0U),
+            m_depth(0U),
+            m_rootMemberCount(0U)
+        {
+            AddCollection("accessors", m_gltfDocument.accessors, ParseAccessor);
+            AddCollection("animations", m_gltfDocument.animations, ParseAnimation);
+            AddCollection("buffers", m_gltfDocument.buffers, ParseBuffer);
+            AddCollection("bufferViews", m_gltfDocument.bufferViews, ParseBufferView);
+            AddCollection("cameras", m_gltfDocument.cameras, ParseCamera);
+            AddCollection("images", m_gltfDocument.images, ParseImage);
+            AddCollection("materials", m_gltfDocument.materials, ParseMaterial);
+            AddCollection("meshes", m_gltfDocument.meshes, ParseMesh);
+            AddCollection("nodes", m_gltfDocument.nodes, ParseNode);
+            AddCollection("samplers", m_gltfDocument.samplers, ParseSampler);
+            AddCollection("scenes", m_gltfDocument.scenes, ParseScene);
+            AddCollection("skins", m_gltfDocument.skins, ParseSkin);
+            AddCollection("textures", m_gltfDocument.textures, ParseTexture);
+        }
+
+        StreamingHandler(const StreamingHandler&) = delete;
+        StreamingHandler& operator=(const StreamingHandler&) = delete;
+
+        bool Null() { return Value([](rapidjson::Document& target) { return target.Null(); }); }
+        bool Bool(bool b) { return Value([b](rapidjson::Document& target) { return target.Bool(b); }); }
+        bool Int(int i) { return Value([i](rapidjson::Document& target) { return target.Int(i); }); }
+        bool Uint(unsigned u) { return Value([u](rapidjson::Document& target) { return target.Uint(u); }); }
+        bool Int64(int64_t i) { return Value([i](rapidjson::Document& target) { return target.Int64(i); }); }
+        bool Uint64(uint64_t u) { return Value([u](rapidjson::Document& target) { return target.Uint64(u); }); }
+        bool Double(double d) { return Value([d](rapidjson::Document& target) { return target.Double(d); }); }
+
+        bool RawNumber(const Ch* str, rapidjson::SizeType length, bool copy)
+        {
+            return Value([=](rapidjson::Document& target) { return target.RawNumber(str, length, copy); });
+        }
+
+        bool String(const Ch* str, rapidjson::SizeType length, bool copy)
+        {
+            return Value([=](rapidjson::Document& target) { return target.String(str, length, copy); });
+        }
+
+        bool StartObject()
+        {
+            return Start(false);
+        }
+
+        bool StartArray()
+        {
+            return Start(true);
+        }
+
+        bool Key(const Ch* str, rapidjson::SizeType length, bool copy)
+        {
+            // The root's keys are only forwarded once it's known whether their value is a top-level array
+            if (!m_collection && m_depth == 1U)
+            {
+                m_key.assign(str, length);
+                return true;
+            }
+
+            return GetTarget().Key(str, length, copy);
+        }
+
+        bool EndObject(rapidjson::SizeType memberCount)
+        {
+            --m_depth;
+
+            // The root DOM doesn't contain the top-level arrays, so it has fewer members than the reader counted
+            if (!m_collection && m_depth == 0U)
+            {
+                memberCount = m_rootMemberCount;
+            }
+
+            return GetTarget().EndObject(memberCount) && EndValue();
+        }
+
+        bool EndArray(rapidjson::SizeType elementCount)
+        {
+            if (m_collection && m_depth == 2U)
+            {
+                m_collection = nullptr;
+                --m_depth;
+                return true;
+            }
+
+            --m_depth;
+
+            return GetTarget().EndArray(elementCount) && EndValue();
+        }
+
+        // Parses the root's other members once the reader has successfully parsed the whole JSON
+        Document Finish()
+        {
+            PopValue(m_root);
+
+            if (!m_root.IsObject())
+            {
+                throw InvalidGLTFException("The root of a glTF document must be a JSON object");
+            }
+
+            ParseRootMembers(m_root, m_gltfDocument, m_extensionDeserializer);
+
+            return std::move(m_gltfDocument);
+        }
+
+    private:
+        struct Collection
+        {
+            std::function<void(const rapidjson::Value&, size_t)> fn;
+            bool isParsed;
+        };
+
+        template<typename T>
+        void AddCollection(const char* name, IndexedContainer<const T>& items, T(*fn)(const rapidjson::Value&, const ExtensionDeserializer&))
+        {
+            m_collections[name] = { [this, name, &items, fn](const rapidjson::Value& value, size_t index)
+            {
+                DeserializeIndexedContainerItem(name, index, value, items, m_extensionDeserializer, fn);
+            }, false };
+        }
+
+        rapidjson::Document& GetTarget()
+        {
+            return m_collection ? m_element : m_root;
+        }
+
+        template<typename Fn>
+        bool Value(Fn fn)
+        {
+            return BeginValue() && fn(GetTarget()) && EndValue();
+        }
+
+        bool Start(bool isArray)
+        {
+            if (!m_collection && m_depth == 1U && isArray)
+            {
+                auto it = m_collections.find(m_key);
+
+                // As with FindMember, only the first occurrence of a top-level array is parsed
+                if (it != m_collections.end() && !it->second.isParsed)
+                {
+                    m_collection = &it->second;
+                    m_collection->isParsed = true;
+                    m_index = 0U;
+                    ++m_depth;
+                    return true;
+                }
+            }
+
+            if (!BeginValue())
+            {
+                return false;
+            }
+
+            ++m_depth;
+
+            return isArray ? GetTarget().StartArray() : GetTarget().StartObject();
+        }
+
+        bool BeginValue()
+        {
+            if (!m_collection && m_depth == 1U)
+            {
+                ++m_rootMemberCount;
+                return m_root.Key(m_key.c_str(), static_cast<rapidjson::SizeType>(m_key.length()), true);
+            }
+
+            return true;
+        }
+
+        // Parses an element of a top-level array as soon as it's complete
+        bool EndValue()
+        {
+            if (m_collection && m_depth == 2U)
+            {
+                PopValue(m_element);
+
+                m_collection->fn(m_element, m_index++);
+
+                m_element.SetNull();
+                m_element.GetAllocator().Clear();
+            }
+
+            return true;
+        }
+
+        // Moves the completed value from the document's stack into the document itself
+        static void PopValue(rapidjson::Document& document)
+        {
+            struct Generator
+            {
+                bool operator()(rapidjson::Document&) const
+                {
+                    return true;
+                }
+            } generator;
+
+            document.Populate(generator);
+        }
+
+        const ExtensionDeserializer& m_extensionDeserializer;
+
+        Document m_gltfDocument;
+
+        rapidjson::Document m_root;
+        rapidjson::Document m_element;
+
+        std::unordered_map<std::string, Collection> m_collections;
+        Collection* m_collection;// The top-level array currently being parsed, if any
+
+        std::string m_key;
+
+        size_t m_index;
+        size_t m_depth;
+
+        rapidjson::SizeType m_rootMemberCount;
+    };
+
+    // Validates the JSON against the schema from the reader's events, as the schema would validate a DOM of the JSON,
+    // without building one
+    template<typename TInputStream>
+    void ValidateStream(TInputStream& inputStream, const CompiledSchema& schema)
+    {
+        rapidjson::SchemaValidator schemaValidator(schema.GetSchemaDocument());
+        rapidjson::Reader reader;
+
+        if (reader.Parse(inputStream, schemaValidator).IsError())
+        {
+            if (!schemaValidator.IsValid())
+            {
+                ThrowSchemaViolation(schemaValidator);
+            }
+
+            // The input is not valid JSON.
+            throw GLTFException("The document is invalid due to bad JSON formatting");
+        }
+    }
+
+    // Builds the Document from the reader's events. The JSON must already have been validated against the schema.
+    template<typename TInputStream>
+    Document DeserializeStreaming(TInputStream& inputStream, const ExtensionDeserializer& extensionDeserializer)
+    {
+        StreamingHandler handler(extensionDeserializer);
+
+        rapidjson::Reader reader;
+
+        if (reader.Parse(inputStream, handler).IsError())
+        {
+            // The input is not valid JSON.
+            throw GLTFException("The document is invalid due to bad JSON formatting");
+        }
+
+        return handler.Finish();
+    }
+
+    // Builds the Document from the reader's events and validates the JSON against the schema in the same pass. Each
+    // value's events are only forwarded to the handler once they've been validated.
+    template<typename TInputStream>
+    Document DeserializeStreamingValidated(TInputStream& inputStream, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema)
+    {
+        StreamingHandler handler(extensionDeserializer);
+
+        rapidjson::GenericSchemaValidator<rapidjson::SchemaDocument, StreamingHandler> schemaValidator(schema.GetSchemaDocument(), handler);
+
+        rapidjson::Reader reader;
+
+        if (reader.Parse(inputStream, schemaValidator).IsError())
+        {
+            if (!schemaValidator.IsValid())
+            {
+                ThrowSchemaViolation(schemaValidator);
+            }
+
+            // The input is not valid JSON.
+            throw GLTFException("The document is invalid due to bad JSON formatting");
+        }
+
+        return handler.Finish();
+    }
+
+    // Parses the JSON into a DOM and validates it against the schema in the same pass
+    template<typename TInputStream>
+    rapidjson::Document CreateValidatedDocument(TInputStream& inputStream, const CompiledSchema& schema)
+    {
+        rapidjson::SchemaValidatingReader<rapidjson::kParseDefaultFlags, TInputStream, rapidjson::UTF8<>> reader(inputStream, schema.GetSchemaDocument());
+        rapidjson::Document document;
+        document.Populate(reader);
+
+        if (reader.GetParseResult().IsError())
+        {
+            if (!reader.IsValid())
+            {
+                ThrowSchemaViolation(reader);
+            }
+
+            // The input is not valid JSON.
+            throw GLTFException("The document is invalid due to bad JSON formatting");
+        }
+
+        return document;
     }
 
     bool HasFlag(DeserializeFlags flags, DeserializeFlags flag)
     {
         return ((flags & flag) == flag);
     }
+
+    Document DeserializeDocument(const rapidjson::Document& document, const ExtensionDeserializer& extensionDeserializer, IExecutor* executor)
+    {
+        return executor ?
+            ParallelDeserializer(document, extensionDeserializer).Deserialize(*executor) :
+            DeserializeInternal(document, extensionDeserializer);
+    }
+
+    // Calls fn with a rapidjson input stream that reads the string from the beginning
+    template<typename Fn>
+    auto WithInputStream(const std::string& json, DeserializeFlags flags, Fn fn) -> decltype(fn(std::declval<rapidjson::StringStream&>()))
+    {
+        if (HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark))
+        {
+            rapidjson::MemoryStream memoryStream(json.c_str(), json.size());
+            rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> encodedStream(memoryStream);
+            return fn(encodedStream);
+        }
+
+        rapidjson::StringStream stringStream(json.c_str());
+        return fn(stringStream);
+    }
+
+    // Calls fn with a rapidjson input stream that reads the std::istream from its current position
+    template<typename Fn>
+    auto WithInputStream(std::istream& jsonStream, DeserializeFlags flags, Fn fn) -> decltype(fn(std::declval<rapidjson::IStreamWrapper&>()))
+    {
+        rapidjson::IStreamWrapper streamWrapper(jsonStream);
+
+        if (HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark))
+        {
+            rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::IStreamWrapper> encodedStream(streamWrapper);
+            return fn(encodedStream);
+        }
+
+        return fn(streamWrapper);
+    }
+
+    // The Streaming mode reads the JSON twice without building a DOM of it. As with the DOM path the whole JSON is
+    // validated against the schema before any of it is parsed, unless ValidateWhileParsing is also specified.
+    Document DeserializeStringStreaming(const std::string& json, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, DeserializeFlags flags)
+    {
+        if (HasFlag(flags, DeserializeFlags::ValidateWhileParsing))
+        {
+            return WithInputStream(json, flags, [&](auto& inputStream)
+            {
+                return DeserializeStreamingValidated(inputStream, extensionDeserializer, schema);
+            });
+        }
+
+        WithInputStream(json, flags, [&schema](auto& inputStream)
+        {
+            ValidateStream(inputStream, schema);
+        });
+
+        return WithInputStream(json, flags, [&extensionDeserializer](auto& inputStream)
+        {
+            return DeserializeStreaming(inputStream, extensionDeserializer);
+        });
+    }
+
+    Document DeserializeStreamStreaming(std::istream& jsonStream, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, DeserializeFlags flags)
+    {
+        if (HasFlag(flags, DeserializeFlags::ValidateWhileParsing))
+        {
+            return WithInputStream(jsonStream, flags, [&](auto& inputStream)
+            {
+                return DeserializeStreamingValidated(inputStream, extensionDeserializer, schema);
+            });
+        }
+
+        const auto position = jsonStream.tellg();
+
+        if (position < 0)
+        {
+            throw GLTFException("The Streaming mode reads the JSON twice so the stream must be seekable, or ValidateWhileParsing must also be specified");
+        }
+
+        WithInputStream(jsonStream, flags, [&schema](auto& inputStream)
+        {
+            ValidateStream(inputStream, schema);
+        });
+
+        jsonStream.clear();
+        jsonStream.seekg(position);
+
+        return WithInputStream(jsonStream, flags, [&extensionDeserializer](auto& inputStream)
+        {
+            return DeserializeStreaming(inputStream, extensionDeserializer);
+        });
+    }
+
+    Document DeserializeString(const std::string& json, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, DeserializeFlags flags, IExecutor* executor)
+    {
+        if (HasFlag(flags, DeserializeFlags::Streaming))
+        {
+            return DeserializeStringStreaming(json, extensionDeserializer, schema, flags);
+        }
+
+        if (HasFlag(flags, DeserializeFlags::ValidateWhileParsing))
+        {
+            return WithInputStream(json, flags, [&](auto& inputStream)
+            {
+                return DeserializeDocument(CreateValidatedDocument(inputStream, schema), extensionDeserializer, executor);
+            });
+        }
+
+        const auto document = HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) ?
+            RapidJsonUtils::CreateDocumentFromEncodedString(json) :
+            RapidJsonUtils::CreateDocumentFromString(json);
+
+        schema.Validate(document);
+
+        return DeserializeDocument(document, extensionDeserializer, executor);
+    }
+
+    Document DeserializeStream(std::istream& jsonStream, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, DeserializeFlags flags, IExecutor* executor)
+    {
+        if (HasFlag(flags, DeserializeFlags::Streaming))
+        {
+            return DeserializeStreamStreaming(jsonStream, extensionDeserializer, schema, flags);
+        }
+
+        if (HasFlag(flags, DeserializeFlags::ValidateWhileParsing))
+        {
+            return WithInputStream(jsonStream, flags, [&](auto& inputStream)
+            {
+                return DeserializeDocument(CreateValidatedDocument(inputStream, schema), extensionDeserializer, executor);
+            });
+        }
+
+        const auto document = HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) ?
+            RapidJsonUtils::CreateDocumentFromEncodedStream(jsonStream) :
+            RapidJsonUtils::CreateDocumentFromStream(jsonStream);
+
+        schema.Validate(document);
+
+        return DeserializeDocument(document, extensionDeserializer, executor);
+    }
 }
 
 Document Microsoft::glTF::Deserialize(const std::string& json, DeserializeFlags flags, SchemaFlags schemaFlags)
@@ -841,11 +1470,17 @@ Document Microsoft::glTF::Deserialize(const std::string& json, DeserializeFlags
 
 Document Microsoft::glTF::Deserialize(const std::string& json, const ExtensionDeserializer& extensionDeserializer, DeserializeFlags flags, SchemaFlags schemaFlags)
 {
-    const auto document = HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) ?
-        RapidJsonUtils::CreateDocumentFromEncodedString(json) :
-        RapidJsonUtils::CreateDocumentFromString(json);
+    return Deserialize(json, extensionDeserializer, *SchemaCache::GetProcessCache()->Get(schemaFlags), flags);
+}
 
-    return DeserializeInternal(document, extensionDeserializer, schemaFlags);
+Document Microsoft::glTF::Deserialize(const std::string& json, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, DeserializeFlags flags)
+{
+    return DeserializeString(json, extensionDeserializer, schema, flags, nullptr);
+}
+
+Document Microsoft::glTF::Deserialize(const std::string& json, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, IExecutor& executor, DeserializeFlags flags)
+{
+    return DeserializeString(json, extensionDeserializer, schema, flags, &executor);
 }
 
 Document Microsoft::glTF::Deserialize(std::istream& jsonStream, DeserializeFlags flags, SchemaFlags schemaFlags)
@@ -855,11 +1490,17 @@ Document Microsoft::glTF::Deserialize(std::istream& jsonStream, DeserializeFlags
 
 Document Microsoft::glTF::Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensionDeserializer, DeserializeFlags flags, SchemaFlags schemaFlags)
 {
-    const auto document = HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) ?
-        RapidJsonUtils::CreateDocumentFromEncodedStream(jsonStream) :
-        RapidJsonUtils::CreateDocumentFromStream(jsonStream);
+    return Deserialize(jsonStream, extensionDeserializer, *SchemaCache::GetProcessCache()->Get(schemaFlags), flags);
+}
 
-    return DeserializeInternal(document, extensionDeserializer, schemaFlags);
+Document Microsoft::glTF::Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, DeserializeFlags flags)
+{
+    return DeserializeStream(jsonStream, extensionDeserializer, schema, flags, nullptr);
+}
+
+Document Microsoft::glTF::Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensionDeserializer, const CompiledSchema& schema, IExecutor& executor, DeserializeFlags flags)
+{
+    return DeserializeStream(jsonStream, extensionDeserializer, schema, flags, &executor);
 }
 
 DeserializeFlags Microsoft::glTF::operator|(DeserializeFlags lhs, DeserializeFlags rhs)
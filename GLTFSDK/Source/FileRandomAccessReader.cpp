@@ -0,0 +1,192 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/FileRandomAccessReader.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#include <algorithm>
+#include <limits>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+#ifdef _WIN32
+class FileRandomAccessReader::File
+{
+public:
+    explicit File(const std::string& path) : m_path(path)
+    {
+        m_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (m_handle == INVALID_HANDLE_VALUE)
+        {
+            throw GLTFException("Unable to open file " + path);
+        }
+
+        LARGE_INTEGER fileSize;
+
+        if (!GetFileSizeEx(m_handle, &fileSize))
+        {
+            CloseHandle(m_handle);
+            throw GLTFException("Unable to query the size of file " + path);
+        }
+
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+    }
+
+    ~File()
+    {
+        CloseHandle(m_handle);
+    }
+
+    void ReadAt(size_t offset, size_t byteCount, void* data) const
+    {
+        auto bytes = static_cast<uint8_t*>(data);
+
+        while (byteCount > 0U)
+        {
+            // ReadFile reads at most 4GB per call, an explicit offset makes the read independent of the file pointer
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32);
+
+            const DWORD bytesToRead = static_cast<DWORD>(std::min<size_t>(byteCount, std::numeric_limits<DWORD>::max()));
+            DWORD bytesRead = 0U;
+
+            if (!ReadFile(m_handle, bytes, bytesToRead, &bytesRead, &overlapped) || bytesRead == 0U)
+            {
+                throw GLTFException("Unable to read from file " + m_path);
+            }
+
+            bytes += bytesRead;
+            offset += bytesRead;
+            byteCount -= bytesRead;
+        }
+    }
+
+    size_t GetSize() const
+    {
+        return m_size;
+    }
+
+private:
+    std::string m_path;
+    HANDLE m_handle;
+    size_t m_size;
+};
+#else
+class FileRandomAccessReader::File
+{
+public:
+    explicit File(const std::string& path) : m_path(path)
+    {
+        m_fd = open(path.c_str(), O_RDONLY);
+
+        if (m_fd == -1)
+        {
+            throw GLTFException("Unable to open file " + path);
+        }
+
+        struct stat fileStat;
+
+        if (fstat(m_fd, &fileStat) != 0)
+        {
+            close(m_fd);
+            throw GLTFException("Unable to query the size of file " + path);
+        }
+
+        m_size = static_cast<size_t>(fileStat.st_size);
+    }
+
+    ~File()
+    {
+        close(m_fd);
+    }
+
+    void ReadAt(size_t offset, size_t byteCount, void* data) const
+    {
+        auto bytes = static_cast<uint8_t*>(data);
+
+        while (byteCount > 0U)
+        {
+            // pread may return fewer bytes than requested (e.g. if interrupted by a signal)
+            const ssize_t bytesRead = pread(m_fd, bytes, byteCount, static_cast<off_t>(offset));
+
+            if (bytesRead <= 0)
+            {
+                throw GLTFException("Unable to read from file " + m_path);
+            }
+
+            bytes += bytesRead;
+            offset += static_cast<size_t>(bytesRead);
+            byteCount -= static_cast<size_t>(bytesRead);
+        }
+    }
+
+    size_t GetSize() const
+    {
+        return m_size;
+    }
+
+private:
+    std::string m_path;
+    int m_fd;
+    size_t m_size;
+};
+#endif
+
+FileRandomAccessReader::FileRandomAccessReader(std::string baseDirectory) : m_baseDirectory(std::move(baseDirectory))
+{
+}
+
+void FileRandomAccessReader::ReadAt(const std::string& uri, size_t offset, size_t byteCount, void* data) const
+{
+    auto file = GetFile(uri);
+
+    if (offset > file->GetSize() || byteCount > file->GetSize() - offset)
+    {
+        throw GLTFException("Read is outside the range of file " + uri);
+    }
+
+    file->ReadAt(offset, byteCount, data);
+}
+
+size_t FileRandomAccessReader::Size(const std::string& uri) const
+{
+    return GetFile(uri)->GetSize();
+}
+
+std::shared_ptr<const FileRandomAccessReader::File> FileRandomAccessReader::GetFile(const std::string& uri) const
+{
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(m_filesMutex);
+
+        auto it = m_files.find(uri);
+
+        if (it != m_files.end())
+        {
+            return it->second;
+        }
+    }
+
+    // Open the file without holding the lock, if another thread opened it first then its handle is used and this one closed
+    auto file = std::make_shared<const File>(m_baseDirectory.empty() ? uri : m_baseDirectory + "/" + uri);
+
+    std::lock_guard<std::shared_timed_mutex> lock(m_filesMutex);
+
+    return m_files.emplace(uri, std::move(file)).first->second;
+}
@@ -5,41 +5,249 @@
 
 #include <GLTFSDK/Constants.h>
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 using namespace Microsoft::glTF;
 
 namespace
 {
-    bool ParseChunkType(const char* expectedChunkType, std::istream& stream)
+    uint32_t ReadUInt32(const uint8_t* data)
     {
-        char buffer[GLB_CHUNK_TYPE_SIZE];
-        stream.read(buffer, GLB_CHUNK_TYPE_SIZE);
-        if (stream.fail())
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    size_t GetStreamByteLength(std::istream& stream)
+    {
+        // NOTE: seekg to the end and then tellg isn't guaranteed to give the number of bytes from the start of the file
+        // (see http://stackoverflow.com/a/22986486) but is relied upon elsewhere in the code too
+        stream.clear();
+        stream.seekg(0, std::ios::end);
+
+        const std::streamoff byteLength = stream.tellg();
+
+        if (byteLength < 0)
         {
-            throw InvalidGLTFException("Cannot read the chunk type: " + std::string(expectedChunkType));
+            throw GLTFException("Unable to determine the length of the GLB stream");
         }
-        auto cmp = memcmp(&buffer[0], expectedChunkType, GLB_CHUNK_TYPE_SIZE);
-        return cmp == 0;
+
+        return static_cast<size_t>(byteLength);
     }
 
-    std::string ReadJson(std::istream& stream, size_t jsonLength)
+    GLBResourceReader::ReadAtFn MakeStreamReadAt(std::istream& stream)
     {
-        stream.seekg(GLB_HEADER_BYTE_SIZE);
-        std::string json(jsonLength, '\0');
-        StreamUtils::ReadBinary(stream, &json[0], jsonLength);
-        if (stream.fail())
+        return [&stream](size_t offset, size_t byteCount, void* data)
+        {
+            stream.clear();
+            stream.seekg(static_cast<std::streamoff>(offset));
+
+            StreamUtils::ReadBinary(stream, static_cast<char*>(data), byteCount);
+        };
+    }
+
+    // Parses the header and chunk headers of a GLB whose bytes can be read at any offset. Each region is only read
+    // once byteLength is known to contain it.
+    GLBHeader ReadHeader(const GLBResourceReader::ReadAtFn& readAt, size_t byteLength)
+    {
+        if (byteLength < GLB_HEADER_BYTE_SIZE)
+        {
+            throw InvalidGLTFException("Cannot read the GLB header");
+        }
+
+        uint8_t header[GLB_HEADER_BYTE_SIZE];
+        readAt(0U, sizeof(header), header);
+
+        const uint32_t version = ReadUInt32(header + GLB_HEADER_MAGIC_STRING_SIZE);
+        const uint32_t length = ReadUInt32(header + GLB_HEADER_MAGIC_STRING_SIZE + sizeof(uint32_t));
+
+        // Verify that the length we just read actually matches the length of the data
+        if (byteLength != length)
+        {
+            throw InvalidGLTFException("File-reported file length does not match actual file length");
+        }
+
+        const uint32_t jsonChunkLength = ReadUInt32(header + GLB2_HEADER_BYTE_SIZE);
+
+        if (memcmp(header + GLB2_HEADER_BYTE_SIZE + sizeof(uint32_t), GLB_CHUNK_TYPE_JSON, GLB_CHUNK_TYPE_SIZE) != 0)
+        {
+            throw InvalidGLTFException("JSON chunk should appear first");
+        }
+
+        // validate header
+        if (memcmp(header, GLB_HEADER_MAGIC_STRING, GLB_HEADER_MAGIC_STRING_SIZE) != 0)
+        {
+            throw InvalidGLTFException("Cannot find GLB magic bytes");
+        }
+
+        if (version != GLB_HEADER_VERSION_2)
+        {
+            throw InvalidGLTFException("Unsupported GLB Version: " + std::to_string(version));
+        }
+
+        // Use size_t arithmetic so that chunk lengths close to UINT32_MAX can't wrap around
+        const size_t jsonChunkEnd = static_cast<size_t>(GLB_HEADER_BYTE_SIZE) + jsonChunkLength;
+
+        if (length < jsonChunkEnd)
+        {
+            throw InvalidGLTFException("File length " + std::to_string(length) + " less than content length " + std::to_string(jsonChunkLength) +
+                " plus header length " + std::to_string(GLB_HEADER_BYTE_SIZE));
+        }
+
+        GLBHeader result = { version, length, GLB_HEADER_BYTE_SIZE, jsonChunkLength, 0U, 0U };
+
+        // If length is exactly equal to the json chunk length, plus the header, it means there is no binary buffer chunk
+        if (length == jsonChunkEnd)
         {
-            throw InvalidGLTFException("Cannot read the json from the GLB file");
+            return result;
         }
-        return json;
+
+        uint8_t bufferChunkHeader[sizeof(uint32_t) + GLB_CHUNK_TYPE_SIZE];
+
+        const size_t bufferChunkBegin = jsonChunkEnd + sizeof(bufferChunkHeader);
+
+        if (length < bufferChunkBegin)
+        {
+            throw InvalidGLTFException("Cannot read the chunk type: " + std::string(GLB_CHUNK_TYPE_BIN));
+        }
+
+        readAt(jsonChunkEnd, sizeof(bufferChunkHeader), bufferChunkHeader);
+
+        // Read the length of the binary buffer chunk
+        const uint32_t bufferChunkLength = ReadUInt32(bufferChunkHeader);
+
+        if (memcmp(bufferChunkHeader + sizeof(uint32_t), GLB_CHUNK_TYPE_BIN, GLB_CHUNK_TYPE_SIZE) != 0)
+        {
+            throw InvalidGLTFException("Binary chunk should appear second");
+        }
+
+        // Verify that the sum of the sizes of the chunks (plus the headers) matches the size of the file
+        if (bufferChunkBegin + bufferChunkLength != length)
+        {
+            throw InvalidGLTFException("File length does not match sum of length of component chunks");
+        }
+
+        result.binChunkOffset = bufferChunkBegin;
+        result.binChunkLength = bufferChunkLength;
+
+        return result;
     }
+
+    // Exposes a range of another stream as a stream of its own, reading the range through a small buffer
+    class ChunkStreamBuffer : public std::streambuf
+    {
+    public:
+        ChunkStreamBuffer(std::shared_ptr<std::istream> stream, size_t byteOffset, size_t byteLength)
+            : m_stream(std::move(stream)),
+            m_byteOffset(byteOffset),
+            m_byteLength(byteLength),
+            m_position(0U),
+            m_buffer(4096U)
+        {
+        }
+
+    protected:
+        int_type underflow() override
+        {
+            if (gptr() < egptr())
+            {
+                return traits_type::to_int_type(*gptr());
+            }
+
+            const size_t byteCount = std::min(m_buffer.size(), m_byteLength - m_position);
+
+            if (byteCount == 0U)
+            {
+                return traits_type::eof();
+            }
+
+            m_stream->clear();
+            m_stream->seekg(static_cast<std::streamoff>(m_byteOffset + m_position));
+            m_stream->read(m_buffer.data(), static_cast<std::streamsize>(byteCount));
+
+            if (static_cast<size_t>(m_stream->gcount()) != byteCount)
+            {
+                return traits_type::eof();
+            }
+
+            m_position += byteCount;
+            setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + byteCount);
+
+            return traits_type::to_int_type(*gptr());
+        }
+
+    private:
+        std::shared_ptr<std::istream> m_stream;
+
+        const size_t m_byteOffset;
+        const size_t m_byteLength;
+        size_t m_position;
+
+        std::vector<char> m_buffer;
+    };
+
+    class ChunkStream : public std::istream
+    {
+    public:
+        ChunkStream(std::shared_ptr<std::istream> stream, size_t byteOffset, size_t byteLength)
+            : std::istream(nullptr),
+            m_streamBuffer(std::move(stream), byteOffset, byteLength)
+        {
+            rdbuf(&m_streamBuffer);
+        }
+
+    private:
+        ChunkStreamBuffer m_streamBuffer;
+    };
+}
+
+GLBHeader Microsoft::glTF::ReadGLBHeader(std::istream& glbStream)
+{
+    return ReadHeader(MakeStreamReadAt(glbStream), GetStreamByteLength(glbStream));
+}
+
+GLBHeader Microsoft::glTF::ReadGLBHeader(const IRandomAccessReader& randomAccessReader, const std::string& glbUri)
+{
+    return ReadHeader([&randomAccessReader, &glbUri](size_t offset, size_t byteCount, void* data)
+    {
+        randomAccessReader.ReadAt(glbUri, offset, byteCount, data);
+    }, randomAccessReader.Size(glbUri));
+}
+
+GLBHeader Microsoft::glTF::ReadGLBHeader(const uint8_t* glbData, size_t byteLength)
+{
+    return ReadHeader([glbData](size_t offset, size_t byteCount, void* data)
+    {
+        std::memcpy(data, glbData + offset, byteCount);
+    }, byteLength);
+}
+
+std::shared_ptr<std::istream> Microsoft::glTF::GetGLBJsonStream(std::shared_ptr<std::istream> glbStream, const GLBHeader& header)
+{
+    if (auto memoryStream = std::dynamic_pointer_cast<MemoryStream>(glbStream))
+    {
+        if (header.jsonChunkOffset + header.jsonChunkLength > memoryStream->GetByteLength())
+        {
+            throw InvalidGLTFException("The JSON chunk is outside the range of the GLB data");
+        }
+
+        const auto& data = memoryStream->GetData();
+        return std::make_shared<MemoryStream>(std::shared_ptr<const uint8_t>(data, data.get() + header.jsonChunkOffset), header.jsonChunkLength);
+    }
+
+    return std::make_shared<ChunkStream>(std::move(glbStream), header.jsonChunkOffset, header.jsonChunkLength);
 }
 
 GLBResourceReader::GLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::shared_ptr<std::istream> glbStream)
     : GLTFResourceReader(std::move(streamReader)),
     m_buffer(std::move(glbStream)),
-    m_bufferOffset()
+    m_bufferOffset(),
+    m_bufferUri(),
+    m_bufferMutex(std::make_unique<std::mutex>()),
+    m_bufferMemoryByteLength()
 {
     Init();
 }
@@ -47,11 +255,29 @@ GLBResourceReader::GLBResourceReader(std::shared_ptr<const IStreamReader> stream
 GLBResourceReader::GLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<std::istream> glbStream)
     : GLTFResourceReader(std::move(streamCache)),
     m_buffer(std::move(glbStream)),
-    m_bufferOffset()
+    m_bufferOffset(),
+    m_bufferUri(),
+    m_bufferMutex(std::make_unique<std::mutex>()),
+    m_bufferMemoryByteLength()
 {
     Init();
 }
 
+GLBResourceReader::GLBResourceReader(std::shared_ptr<const IRandomAccessReader> randomAccessReader, std::string glbUri)
+    : GLTFResourceReader(std::move(randomAccessReader)),
+    m_bufferOffset(),
+    m_bufferUri(std::move(glbUri)),
+    m_bufferMutex(std::make_unique<std::mutex>()),
+    m_bufferMemoryByteLength()
+{
+    const auto& reader = GetRandomAccessReader();
+
+    InitFromRandomAccess([&reader, this](size_t offset, size_t byteCount, void* data)
+    {
+        reader->ReadAt(m_bufferUri, offset, byteCount, data);
+    }, reader->Size(m_bufferUri));
+}
+
 std::shared_ptr<std::istream> GLBResourceReader::GetBinaryStream(const Buffer& buffer) const
 {
     std::shared_ptr<std::istream> stream;
@@ -59,6 +285,11 @@ std::shared_ptr<std::istream> GLBResourceReader::GetBinaryStream(const Buffer& b
     // We allow "uri": "data:," to refer to a GLB buffer
     if (buffer.uri.empty() || buffer.uri == EMPTY_URI)
     {
+        if (!m_buffer)
+        {
+            throw GLTFException("Buffer streams are unavailable when reading via an IRandomAccessReader");
+        }
+
         stream = m_buffer;
     }
     else
@@ -91,82 +322,93 @@ const std::string& GLBResourceReader::GetJson() const
     return m_json;
 }
 
-void GLBResourceReader::Init()
+std::shared_ptr<const uint8_t> GLBResourceReader::GetBinaryMemory(const Buffer& buffer, size_t& byteCount) const
 {
-    // Get the length of the stream before reading anything, to validate against later
-    // NOTE: The approach used below with seekg to the end and then tellg may be problematic since
-    // seekg is not guaranteed to give the number of bytes from the start of the file:
-    // see http://stackoverflow.com/a/22986486. This is used elsewhere in the code though,
-    // and seems to Do The Right Thing as of right now. TODO: discuss fixing this problem.
-    const auto curPos = m_buffer->tellg();
-    m_buffer->seekg(0, std::ios::end);
-    uint32_t trueStreamLength = static_cast<uint32_t>(m_buffer->tellg()); // in bytes (i.e. sizeof(char))
-    m_buffer->seekg(curPos); // reset the stream pointer where it was
-
-    char magic[GLB_HEADER_MAGIC_STRING_SIZE];
-    m_buffer->read(magic, sizeof(magic));
-    if (m_buffer->fail())
+    // We allow "uri": "data:," to refer to a GLB buffer
+    if (buffer.uri.empty() || buffer.uri == EMPTY_URI)
     {
-        throw InvalidGLTFException("Cannot read the magic number");
+        byteCount = m_bufferMemoryByteLength;
+        return m_bufferMemory;
     }
 
-    const uint32_t version = StreamUtils::ReadBinary<uint32_t>(*m_buffer);
-    const uint32_t length = StreamUtils::ReadBinary<uint32_t>(*m_buffer);
+    return GLTFResourceReader::GetBinaryMemory(buffer, byteCount);
+}
 
-    // Verify that the length we just read actually matches the length of the stream
-    if (trueStreamLength != length)
+void GLBResourceReader::ReadBinaryStream(const Buffer& buffer, std::streamoff offset, void* data, size_t byteCount) const
+{
+    // We allow "uri": "data:," to refer to a GLB buffer
+    if ((buffer.uri.empty() || buffer.uri == EMPTY_URI) && !m_buffer)
     {
-        throw InvalidGLTFException("File-reported file length does not match actual file length");
-    }
-
-    const uint32_t jsonChunkLength = StreamUtils::ReadBinary<uint32_t>(*m_buffer);
+        if (offset < 0)
+        {
+            throw GLTFException("Negative offsets are not supported");
+        }
 
-    if (!ParseChunkType(GLB_CHUNK_TYPE_JSON, *m_buffer))
-    {
-        throw InvalidGLTFException("JSON chunk should appear first");
+        GetRandomAccessReader()->ReadAt(m_bufferUri, static_cast<size_t>(m_bufferOffset + offset), byteCount, data);
     }
-
-    // validate header
-    if (strncmp(magic, GLB_HEADER_MAGIC_STRING, GLB_HEADER_MAGIC_STRING_SIZE) != 0)
+    else if (buffer.uri.empty() || buffer.uri == EMPTY_URI)
     {
-        throw InvalidGLTFException("Cannot find GLB magic bytes");
+        // Unlike external buffers, every thread shares the same GLB stream so the seek and read must not be interleaved
+        std::lock_guard<std::mutex> lock(*m_bufferMutex);
+        GLTFResourceReader::ReadBinaryStream(buffer, offset, data, byteCount);
     }
-
-    if (version != GLB_HEADER_VERSION_2)
+    else
     {
-        throw InvalidGLTFException("Unsupported GLB Version: " + std::to_string(version));
+        GLTFResourceReader::ReadBinaryStream(buffer, offset, data, byteCount);
     }
+}
 
-    // Length has been validated as the actual length of the file, but make sure to include the header bytes in this check
-    if (length < (GLB_HEADER_BYTE_SIZE + jsonChunkLength))
+void GLBResourceReader::Init()
+{
+    if (auto memoryStream = std::dynamic_pointer_cast<MemoryStream>(m_buffer))
     {
-        throw InvalidGLTFException("File length " + std::to_string(length) + " less than content length " + std::to_string(jsonChunkLength) + 
-            " plus header length " + std::to_string(GLB_HEADER_BYTE_SIZE));
+        InitFromMemory(*memoryStream);
+        return;
     }
 
-    m_json = ReadJson(*m_buffer, jsonChunkLength);
+    InitFromRandomAccess(MakeStreamReadAt(*m_buffer), GetStreamByteLength(*m_buffer));
+}
 
-    // If length is exactly equal to the json chunk length, plus the header, it means there is no binary buffer chunk
-    if (length == (GLB_HEADER_BYTE_SIZE + jsonChunkLength))
-    {
-        return;
-    }
+void GLBResourceReader::InitFromMemory(const MemoryStream& memoryStream)
+{
+    const uint8_t* data = memoryStream.GetData().get();
 
-    // Read the length of the binary buffer chunk
-    const uint32_t bufferChunkLength = StreamUtils::ReadBinary<uint32_t>(*m_buffer);
+    const size_t bufferChunkLength = InitFromRandomAccess([data](size_t offset, size_t byteCount, void* dst)
+    {
+        std::memcpy(dst, data + offset, byteCount);
+    }, memoryStream.GetByteLength());
 
-    if (!ParseChunkType(GLB_CHUNK_TYPE_BIN, *m_buffer))
+    if (m_bufferOffset != 0)
     {
-        throw InvalidGLTFException("Binary chunk should appear second");
+        m_bufferMemory = std::shared_ptr<const uint8_t>(memoryStream.GetData(), data + m_bufferOffset);
+        m_bufferMemoryByteLength = bufferChunkLength;
     }
+}
+
+// Parses the header and JSON chunk of a GLB whose bytes can be read at any offset, and validates the BIN chunk's header.
+// Returns the length of the BIN chunk, if there is one.
+size_t GLBResourceReader::InitFromRandomAccess(const ReadAtFn& readAt, size_t byteLength)
+{
+    const GLBHeader header = ReadHeader(readAt, byteLength);
 
-    // Verify that the sum of the sizes of the chunks (plus the headers) matches the size of the file
-    const uint32_t chunkSizeSum = GLB_HEADER_BYTE_SIZE + jsonChunkLength + sizeof(bufferChunkLength) + GLB_CHUNK_TYPE_SIZE +  bufferChunkLength;
+    m_json.resize(header.jsonChunkLength);
 
-    if (chunkSizeSum != length)
+    if (header.jsonChunkLength > 0U)
     {
-        throw InvalidGLTFException("File length does not match sum of length of component chunks");
+        readAt(header.jsonChunkOffset, header.jsonChunkLength, &m_json[0]);
     }
 
-    m_bufferOffset = m_buffer->tellg();
+    m_bufferOffset = static_cast<std::streamoff>(header.binChunkOffset);
+
+    return header.binChunkLength;
+}
+
+GLBMappedResourceReader::GLBMappedResourceReader(std::shared_ptr<const IStreamReader> streamReader, const std::string& glbPath)
+    : GLBResourceReader(std::move(streamReader), MemoryStream::MapFile(glbPath))
+{
+}
+
+GLBMappedResourceReader::GLBMappedResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, const std::string& glbPath)
+    : GLBResourceReader(std::move(streamCache), MemoryStream::MapFile(glbPath))
+{
 }
@@ -0,0 +1,504 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/GLTFResourceReader.h>
+
+#include <GLTFSDK/ThreadPoolExecutor.h>
+
+#include <thread>
+
+using namespace Microsoft::glTF;
+
+constexpr size_t GLTFResourceReader::DefaultMaxReadGapByteLength;
+
+namespace
+{
+    // The executor used by every ReadBinaryDataBatch call that asks for one thread per hardware thread. It's created on
+    // first use and its threads are reused by later calls. The calling thread also takes part so it has one fewer
+    // worker thread than there are hardware threads. Only used when there's more than one hardware thread.
+    IExecutor& GetSharedExecutor()
+    {
+        static ThreadPoolExecutor executor(std::thread::hardware_concurrency() - 1U);
+        return executor;
+    }
+
+    // The ids of the mesh primitive's indices, attribute and morph target accessors
+    std::vector<std::string> GetAccessorIds(const MeshPrimitive& meshPrimitive)
+    {
+        std::vector<std::string> accessorIds;
+
+        if (!meshPrimitive.indicesAccessorId.empty())
+        {
+            accessorIds.push_back(meshPrimitive.indicesAccessorId);
+        }
+
+        for (const auto& attribute : meshPrimitive.attributes)
+        {
+            accessorIds.push_back(attribute.second);
+        }
+
+        for (const auto& target : meshPrimitive.targets)
+        {
+            for (const auto* accessorId : { &target.positionsAccessorId, &target.normalsAccessorId, &target.tangentsAccessorId })
+            {
+                if (!accessorId->empty())
+                {
+                    accessorIds.push_back(*accessorId);
+                }
+            }
+        }
+
+        return accessorIds;
+    }
+
+    std::unordered_map<std::string, AccessorData> MakeAccessorDataMap(const std::vector<std::string>& accessorIds, std::vector<AccessorData> data)
+    {
+        std::unordered_map<std::string, AccessorData> result;
+
+        for (size_t i = 0U; i < accessorIds.size(); ++i)
+        {
+            result.emplace(accessorIds[i], std::move(data[i]));
+        }
+
+        return result;
+    }
+
+    // A contiguous byte range of a buffer that is read (or decoded) once and shared by all the accessors it spans
+    struct BatchRange
+    {
+        size_t byteBegin;
+        size_t byteEnd;
+
+        std::shared_ptr<std::vector<uint8_t>> data;
+    };
+
+    struct BatchBuffer
+    {
+        const Buffer* buffer;
+
+        // Set when the buffer's data is already resident in memory, no ranges need to be read in this case
+        std::shared_ptr<const uint8_t> memory;
+        size_t memoryByteCount;
+
+        std::vector<size_t> items;
+        std::vector<BatchRange> ranges;
+    };
+
+    struct BatchItem
+    {
+        const Accessor* accessor;
+
+        size_t elementSize;
+        size_t byteStride;
+        size_t byteOffset;// Relative to the start of the buffer
+        size_t spanByteLength;
+
+        size_t bufferIndex;
+        size_t rangeIndex;
+
+        bool isRead;
+        AccessorData data;
+    };
+}
+
+std::shared_ptr<const uint8_t> GLTFResourceReader::ReadBinaryDataView(const Document& document, const Image& image, size_t& byteLength) const
+{
+    size_t byteCount;
+
+    if (image.uri.empty())
+    {
+        if (image.bufferViewId.empty())
+        {
+            throw GLTFException("Invalid image, both uri and bufferView are unspecified");
+        }
+
+        const BufferView& bufferView = document.bufferViews.Get(image.bufferViewId);
+        const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+        Validation::ValidateBufferView(bufferView, buffer);
+
+        auto memory = GetBinaryMemory(buffer, byteCount);
+
+        if (!memory || bufferView.byteOffset > byteCount || bufferView.byteLength > byteCount - bufferView.byteOffset)
+        {
+            return {};
+        }
+
+        byteLength = bufferView.byteLength;
+
+        return std::shared_ptr<const uint8_t>(memory, memory.get() + bufferView.byteOffset);
+    }
+
+    // Base64 data uris always have to be decoded
+    if (IsUriBase64(image.uri))
+    {
+        return {};
+    }
+
+    Buffer uriBuffer;
+    uriBuffer.uri = image.uri;
+
+    auto memory = GetBinaryMemory(uriBuffer, byteCount);
+
+    if (memory)
+    {
+        byteLength = byteCount;
+    }
+
+    return memory;
+}
+
+size_t GLTFResourceReader::ReadBinaryDataChunked(const Document& document, const Image& image, const ChunkCallback& callback, size_t chunkByteLength) const
+{
+    if (chunkByteLength == 0U)
+    {
+        throw GLTFException("The chunk length must be greater than zero");
+    }
+
+    size_t byteLength;
+
+    if (auto memory = ReadBinaryDataView(document, image, byteLength))
+    {
+        for (size_t offset = 0U; offset < byteLength; offset += chunkByteLength)
+        {
+            callback(memory.get() + offset, std::min(chunkByteLength, byteLength - offset));
+        }
+
+        return byteLength;
+    }
+
+    std::function<void(size_t offset, size_t byteCount, uint8_t* data)> readAt;
+
+    std::string::const_iterator itBegin;
+    std::string::const_iterator itEnd;
+
+    Buffer uriBuffer;
+
+    if (image.uri.empty())
+    {
+        const BufferView& bufferView = document.bufferViews.Get(image.bufferViewId);
+        const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+        byteLength = bufferView.byteLength;
+
+        readAt = [this, &buffer, &bufferView](size_t offset, size_t byteCount, uint8_t* data)
+        {
+            ReadBinaryData<uint8_t>(buffer, static_cast<std::streamoff>(bufferView.byteOffset + offset), byteCount, data);
+        };
+    }
+    else if (IsUriBase64(image.uri, itBegin, itEnd))
+    {
+        const Base64StringView encodedData(itBegin, itEnd);
+
+        byteLength = encodedData.GetByteCount();
+
+        // Only the chunk (plus at most two preceding bytes) is decoded by each call
+        readAt = [this, encodedData](size_t offset, size_t byteCount, uint8_t* data)
+        {
+            const std::streamoff offsetOverride = static_cast<std::streamoff>(offset);
+            ReadBinaryDataUri(encodedData, Base64BufferView(data, byteCount), &offsetOverride);
+        };
+    }
+    else
+    {
+        uriBuffer.uri = image.uri;
+
+        if (m_randomAccessReader)
+        {
+            byteLength = m_randomAccessReader->Size(image.uri);
+        }
+        else
+        {
+            auto stream = GetBinaryStream(uriBuffer);
+
+            stream->clear();
+            stream->seekg(0, std::ios::end);
+
+            const std::streamoff streamLength = stream->tellg();
+
+            if (streamLength < 0)
+            {
+                throw GLTFException("Unable to determine the size of image " + image.uri);
+            }
+
+            byteLength = static_cast<size_t>(streamLength);
+        }
+
+        readAt = [this, &uriBuffer](size_t offset, size_t byteCount, uint8_t* data)
+        {
+            ReadBinaryStream(uriBuffer, static_cast<std::streamoff>(offset), data, byteCount);
+        };
+    }
+
+    std::vector<uint8_t> chunk(std::min(chunkByteLength, byteLength));
+
+    for (size_t offset = 0U; offset < byteLength; offset += chunkByteLength)
+    {
+        const size_t byteCount = std::min(chunkByteLength, byteLength - offset);
+
+        readAt(offset, byteCount, chunk.data());
+        callback(chunk.data(), byteCount);
+    }
+
+    return byteLength;
+}
+
+std::vector<AccessorData> GLTFResourceReader::ReadBinaryDataBatch(const Document& document, const std::vector<std::string>& accessorIds, size_t threadCount) const
+{
+    const size_t hardwareThreadCount = std::max(1U, std::thread::hardware_concurrency());
+
+    if (threadCount == 0U)
+    {
+        threadCount = hardwareThreadCount;
+    }
+
+    if (threadCount == 1U)
+    {
+        InlineExecutor executor;
+        return ReadBinaryDataBatch(document, accessorIds, executor);
+    }
+
+    if (threadCount == hardwareThreadCount)
+    {
+        return ReadBinaryDataBatch(document, accessorIds, GetSharedExecutor());
+    }
+
+    // The calling thread also takes part so one fewer worker thread is needed
+    ThreadPoolExecutor executor(threadCount - 1U);
+    return ReadBinaryDataBatch(document, accessorIds, executor);
+}
+
+std::vector<AccessorData> GLTFResourceReader::ReadBinaryDataBatch(const Document& document, const std::vector<std::string>& accessorIds, IExecutor& executor) const
+{
+    std::vector<BatchItem> items;
+    std::vector<BatchBuffer> buffers;
+
+    std::unordered_map<std::string, size_t> itemIndices;
+    std::unordered_map<std::string, size_t> bufferIndices;
+
+    std::vector<size_t> resultItems;
+    resultItems.reserve(accessorIds.size());
+
+    // Validate each accessor and group them by buffer. Everything that touches the streams (including reading sparse
+    // accessors, whose data may span several buffers) happens on the calling thread as the stream cache may not be
+    // thread-safe.
+    for (const auto& accessorId : accessorIds)
+    {
+        auto itItem = itemIndices.emplace(accessorId, items.size());
+
+        resultItems.push_back(itItem.first->second);
+
+        if (!itItem.second)
+        {
+            continue;
+        }
+
+        const Accessor& accessor = document.accessors.Get(accessorId);
+
+        Validation::ValidateAccessor(document, accessor);
+
+        items.push_back({ &accessor, 0U, 0U, 0U, 0U, 0U, 0U, false, {} });
+
+        BatchItem& item = items.back();
+
+        if (accessor.sparse.count > 0U || accessor.bufferViewId.empty() || accessor.count == 0U)
+        {
+            item.data = ReadAccessorData(document, accessor);
+            item.isRead = true;
+            continue;
+        }
+
+        const BufferView& bufferView = document.bufferViews.Get(accessor.bufferViewId);
+        const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+        item.elementSize = Accessor::GetComponentTypeSize(accessor.componentType) * Accessor::GetTypeCount(accessor.type);
+        item.byteStride = bufferView.byteStride ? bufferView.byteStride.Get() : item.elementSize;
+        item.byteOffset = accessor.byteOffset + bufferView.byteOffset;
+        item.spanByteLength = (accessor.count - 1U) * item.byteStride + item.elementSize;
+
+        auto itBuffer = bufferIndices.emplace(buffer.id, buffers.size());
+
+        if (itBuffer.second)
+        {
+            buffers.push_back({ &buffer, nullptr, 0U, {}, {} });
+            buffers.back().memory = GetBinaryMemory(buffer, buffers.back().memoryByteCount);
+        }
+
+        item.bufferIndex = itBuffer.first->second;
+        buffers[item.bufferIndex].items.push_back(items.size() - 1U);
+    }
+
+    // Coalesce the byte ranges of each buffer's accessors and read the stream backed ranges. Base64 ranges are only
+    // decoded later (in parallel) as decoding doesn't require access to the stream.
+    std::vector<std::pair<size_t, size_t>> base64Ranges;
+
+    for (size_t bufferIndex = 0U; bufferIndex < buffers.size(); ++bufferIndex)
+    {
+        BatchBuffer& batchBuffer = buffers[bufferIndex];
+
+        if (batchBuffer.memory)
+        {
+            for (auto itemIndex : batchBuffer.items)
+            {
+                const BatchItem& item = items[itemIndex];
+
+                if (item.byteOffset > batchBuffer.memoryByteCount || item.spanByteLength > batchBuffer.memoryByteCount - item.byteOffset)
+                {
+                    throw GLTFException("Accessor data is outside the range of the buffer's binary data");
+                }
+            }
+
+            continue;
+        }
+
+        std::string::const_iterator itBegin;
+        std::string::const_iterator itEnd;
+
+        const bool isBase64 = IsUriBase64(batchBuffer.buffer->uri, itBegin, itEnd);
+
+        std::vector<ByteRange> itemRanges;
+        itemRanges.reserve(batchBuffer.items.size());
+
+        for (auto itemIndex : batchBuffer.items)
+        {
+            const BatchItem& item = items[itemIndex];
+            itemRanges.push_back({ item.byteOffset, item.byteOffset + item.spanByteLength });
+        }
+
+        for (const auto& range : CoalesceByteRanges(std::move(itemRanges), isBase64 ? 0U : m_maxReadGapByteLength))
+        {
+            batchBuffer.ranges.push_back({ range.byteBegin, range.byteEnd, std::make_shared<std::vector<uint8_t>>() });
+        }
+
+        // Slice each accessor out of the range that contains it
+        for (auto itemIndex : batchBuffer.items)
+        {
+            BatchItem& item = items[itemIndex];
+
+            auto itRange = std::upper_bound(batchBuffer.ranges.begin(), batchBuffer.ranges.end(), item.byteOffset, [](size_t byteOffset, const BatchRange& range)
+            {
+                return byteOffset < range.byteBegin;
+            });
+
+            item.rangeIndex = static_cast<size_t>(itRange - batchBuffer.ranges.begin()) - 1U;
+        }
+
+        if (isBase64)
+        {
+            for (size_t rangeIndex = 0U; rangeIndex < batchBuffer.ranges.size(); ++rangeIndex)
+            {
+                base64Ranges.emplace_back(bufferIndex, rangeIndex);
+            }
+        }
+        else
+        {
+            for (auto& range : batchBuffer.ranges)
+            {
+                range.data->resize(range.byteEnd - range.byteBegin);
+
+                ReadBinaryStream(*batchBuffer.buffer, static_cast<std::streamoff>(range.byteBegin), range.data->data(), range.data->size());
+            }
+        }
+    }
+
+    ParallelFor(base64Ranges.size(), executor, [this, &buffers, &base64Ranges](size_t i)
+    {
+        const BatchBuffer& batchBuffer = buffers[base64Ranges[i].first];
+        const BatchRange& range = batchBuffer.ranges[base64Ranges[i].second];
+
+        std::string::const_iterator itBegin;
+        std::string::const_iterator itEnd;
+
+        IsUriBase64(batchBuffer.buffer->uri, itBegin, itEnd);
+
+        const std::streamoff offset = static_cast<std::streamoff>(range.byteBegin);
+
+        range.data->resize(range.byteEnd - range.byteBegin);
+        ReadBinaryDataUri({ itBegin, itEnd }, Base64BufferView(*range.data), &offset);
+    });
+
+    // Extract each accessor's elements from the resident memory or the ranges that were read
+    ParallelFor(items.size(), executor, [&buffers, &items](size_t i)
+    {
+        BatchItem& item = items[i];
+
+        if (item.isRead)
+        {
+            return;
+        }
+
+        const Accessor& accessor = *item.accessor;
+        const BatchBuffer& batchBuffer = buffers[item.bufferIndex];
+
+        std::shared_ptr<const uint8_t> source;
+
+        if (batchBuffer.memory)
+        {
+            source = std::shared_ptr<const uint8_t>(batchBuffer.memory, batchBuffer.memory.get() + item.byteOffset);
+        }
+        else
+        {
+            const BatchRange& range = batchBuffer.ranges[item.rangeIndex];
+            source = std::shared_ptr<const uint8_t>(range.data, range.data->data() + (item.byteOffset - range.byteBegin));
+        }
+
+        const size_t componentSize = Accessor::GetComponentTypeSize(accessor.componentType);
+
+        // Tightly packed and suitably aligned data can be referenced directly rather than copied
+        if (item.byteStride == item.elementSize && reinterpret_cast<uintptr_t>(source.get()) % componentSize == 0U)
+        {
+            item.data = AccessorData(std::move(source), accessor.count, accessor.type, accessor.componentType);
+        }
+        else
+        {
+            auto data = std::make_shared<std::vector<uint8_t>>(accessor.count * item.elementSize);
+
+            GatherElements(source.get(), data->data(), accessor.count, item.elementSize, item.byteStride);
+
+            item.data = AccessorData(std::shared_ptr<const uint8_t>(data, data->data()), accessor.count, accessor.type, accessor.componentType);
+        }
+    });
+
+    std::vector<AccessorData> result;
+    result.reserve(resultItems.size());
+
+    for (auto itemIndex : resultItems)
+    {
+        result.push_back(items[itemIndex].data);
+    }
+
+    return result;
+}
+
+std::unordered_map<std::string, AccessorData> GLTFResourceReader::ReadBinaryDataBatch(const Document& document, const MeshPrimitive& meshPrimitive, size_t threadCount) const
+{
+    auto accessorIds = GetAccessorIds(meshPrimitive);
+    return MakeAccessorDataMap(accessorIds, ReadBinaryDataBatch(document, accessorIds, threadCount));
+}
+
+std::unordered_map<std::string, AccessorData> GLTFResourceReader::ReadBinaryDataBatch(const Document& document, const MeshPrimitive& meshPrimitive, IExecutor& executor) const
+{
+    auto accessorIds = GetAccessorIds(meshPrimitive);
+    return MakeAccessorDataMap(accessorIds, ReadBinaryDataBatch(document, accessorIds, executor));
+}
+
+AccessorData GLTFResourceReader::ReadAccessorData(const Document& document, const Accessor& accessor) const
+{
+    switch (accessor.componentType)
+    {
+    case COMPONENT_BYTE:
+        return AccessorData(ReadBinaryData<int8_t>(document, accessor), accessor.type, accessor.componentType);
+    case COMPONENT_UNSIGNED_BYTE:
+        return AccessorData(ReadBinaryData<uint8_t>(document, accessor), accessor.type, accessor.componentType);
+    case COMPONENT_SHORT:
+        return AccessorData(ReadBinaryData<int16_t>(document, accessor), accessor.type, accessor.componentType);
+    case COMPONENT_UNSIGNED_SHORT:
+        return AccessorData(ReadBinaryData<uint16_t>(document, accessor), accessor.type, accessor.componentType);
+    case COMPONENT_UNSIGNED_INT:
+        return AccessorData(ReadBinaryData<uint32_t>(document, accessor), accessor.type, accessor.componentType);
+    case COMPONENT_FLOAT:
+        return AccessorData(ReadBinaryData<float>(document, accessor), accessor.type, accessor.componentType);
+    default:
+        throw GLTFException("Unsupported accessor ComponentType");
+    }
+}
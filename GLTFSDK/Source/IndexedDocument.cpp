@@ -0,0 +1,247 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/IndexedDocument.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#include <algorithm>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // Resolves an id to the index of the element in the container, or InvalidIndex for an empty id
+    template<typename T>
+    uint32_t ResolveIndex(const IndexedContainer<const T>& container, const std::string& id)
+    {
+        if (id.empty())
+        {
+            return IndexedDocument::InvalidIndex;
+        }
+
+        return static_cast<uint32_t>(container.GetIndex(id));
+    }
+
+    template<typename T>
+    std::vector<uint32_t> ResolveIndices(const IndexedContainer<const T>& container, const std::vector<std::string>& ids)
+    {
+        std::vector<uint32_t> indices;
+        indices.reserve(ids.size());
+
+        for (const auto& id : ids)
+        {
+            indices.push_back(static_cast<uint32_t>(container.GetIndex(id)));
+        }
+
+        return indices;
+    }
+
+    template<typename T>
+    void CheckSize(const IndexedContainer<const T>& container, const char* name)
+    {
+        if (container.Size() >= IndexedDocument::InvalidIndex)
+        {
+            throw GLTFException(std::string("Too many ") + name + " for 32-bit indices");
+        }
+    }
+
+    IndexedMeshPrimitive CreateMeshPrimitive(const Document& document, const MeshPrimitive& meshPrimitive)
+    {
+        IndexedMeshPrimitive result;
+
+        result.attributes.reserve(meshPrimitive.attributes.size());
+
+        for (const auto& attribute : meshPrimitive.attributes)
+        {
+            result.attributes.push_back({ attribute.first, ResolveIndex(document.accessors, attribute.second) });
+        }
+
+        std::sort(result.attributes.begin(), result.attributes.end(), [](const IndexedAttribute& lhs, const IndexedAttribute& rhs)
+        {
+            return lhs.name < rhs.name;
+        });
+
+        result.indicesAccessor = ResolveIndex(document.accessors, meshPrimitive.indicesAccessorId);
+        result.material = ResolveIndex(document.materials, meshPrimitive.materialId);
+
+        result.targets.reserve(meshPrimitive.targets.size());
+
+        for (const auto& target : meshPrimitive.targets)
+        {
+            result.targets.push_back({
+                ResolveIndex(document.accessors, target.positionsAccessorId),
+                ResolveIndex(document.accessors, target.normalsAccessorId),
+                ResolveIndex(document.accessors, target.tangentsAccessorId)
+            });
+        }
+
+        return result;
+    }
+
+    IndexedAnimation CreateAnimation(const Document& document, const Animation& animation)
+    {
+        CheckSize(animation.channels, "animation channels");
+        CheckSize(animation.samplers, "animation samplers");
+
+        IndexedAnimation result;
+
+        result.channels.reserve(animation.channels.Size());
+
+        for (const auto& channel : animation.channels.Elements())
+        {
+            result.channels.push_back({
+                ResolveIndex(animation.samplers, channel.samplerId),
+                ResolveIndex(document.nodes, channel.target.nodeId)
+            });
+        }
+
+        result.samplers.reserve(animation.samplers.Size());
+
+        for (const auto& sampler : animation.samplers.Elements())
+        {
+            result.samplers.push_back({
+                ResolveIndex(document.accessors, sampler.inputAccessorId),
+                ResolveIndex(document.accessors, sampler.outputAccessorId)
+            });
+        }
+
+        return result;
+    }
+}
+
+constexpr uint32_t IndexedDocument::InvalidIndex;
+
+uint32_t IndexedMeshPrimitive::GetAttributeAccessor(const std::string& name) const
+{
+    auto it = std::lower_bound(attributes.begin(), attributes.end(), name, [](const IndexedAttribute& attribute, const std::string& value)
+    {
+        return attribute.name < value;
+    });
+
+    if (it != attributes.end() && it->name == name)
+    {
+        return it->accessor;
+    }
+
+    return IndexedDocument::InvalidIndex;
+}
+
+IndexedDocument::IndexedDocument(const Document& document) : defaultScene(InvalidIndex)
+{
+    CheckSize(document.accessors, "accessors");
+    CheckSize(document.animations, "animations");
+    CheckSize(document.buffers, "buffers");
+    CheckSize(document.bufferViews, "buffer views");
+    CheckSize(document.cameras, "cameras");
+    CheckSize(document.images, "images");
+    CheckSize(document.materials, "materials");
+    CheckSize(document.meshes, "meshes");
+    CheckSize(document.nodes, "nodes");
+    CheckSize(document.samplers, "samplers");
+    CheckSize(document.scenes, "scenes");
+    CheckSize(document.skins, "skins");
+    CheckSize(document.textures, "textures");
+
+    accessors.reserve(document.accessors.Size());
+
+    for (const auto& accessor : document.accessors.Elements())
+    {
+        accessors.push_back({
+            ResolveIndex(document.bufferViews, accessor.bufferViewId),
+            ResolveIndex(document.bufferViews, accessor.sparse.indicesBufferViewId),
+            ResolveIndex(document.bufferViews, accessor.sparse.valuesBufferViewId)
+        });
+    }
+
+    animations.reserve(document.animations.Size());
+
+    for (const auto& animation : document.animations.Elements())
+    {
+        animations.push_back(CreateAnimation(document, animation));
+    }
+
+    bufferViews.reserve(document.bufferViews.Size());
+
+    for (const auto& bufferView : document.bufferViews.Elements())
+    {
+        bufferViews.push_back({ ResolveIndex(document.buffers, bufferView.bufferId) });
+    }
+
+    images.reserve(document.images.Size());
+
+    for (const auto& image : document.images.Elements())
+    {
+        images.push_back({ ResolveIndex(document.bufferViews, image.bufferViewId) });
+    }
+
+    materials.reserve(document.materials.Size());
+
+    for (const auto& material : document.materials.Elements())
+    {
+        materials.push_back({
+            ResolveIndex(document.textures, material.metallicRoughness.baseColorTexture.textureId),
+            ResolveIndex(document.textures, material.metallicRoughness.metallicRoughnessTexture.textureId),
+            ResolveIndex(document.textures, material.normalTexture.textureId),
+            ResolveIndex(document.textures, material.occlusionTexture.textureId),
+            ResolveIndex(document.textures, material.emissiveTexture.textureId)
+        });
+    }
+
+    meshes.reserve(document.meshes.Size());
+
+    for (const auto& mesh : document.meshes.Elements())
+    {
+        IndexedMesh indexedMesh;
+        indexedMesh.primitives.reserve(mesh.primitives.size());
+
+        for (const auto& meshPrimitive : mesh.primitives)
+        {
+            indexedMesh.primitives.push_back(CreateMeshPrimitive(document, meshPrimitive));
+        }
+
+        meshes.push_back(std::move(indexedMesh));
+    }
+
+    nodes.reserve(document.nodes.Size());
+
+    for (const auto& node : document.nodes.Elements())
+    {
+        nodes.push_back({
+            ResolveIndex(document.cameras, node.cameraId),
+            ResolveIndex(document.meshes, node.meshId),
+            ResolveIndex(document.skins, node.skinId),
+            ResolveIndices(document.nodes, node.children)
+        });
+    }
+
+    scenes.reserve(document.scenes.Size());
+
+    for (const auto& scene : document.scenes.Elements())
+    {
+        scenes.push_back({ ResolveIndices(document.nodes, scene.nodes) });
+    }
+
+    skins.reserve(document.skins.Size());
+
+    for (const auto& skin : document.skins.Elements())
+    {
+        skins.push_back({
+            ResolveIndex(document.accessors, skin.inverseBindMatricesAccessorId),
+            ResolveIndex(document.nodes, skin.skeletonId),
+            ResolveIndices(document.nodes, skin.jointIds)
+        });
+    }
+
+    textures.reserve(document.textures.Size());
+
+    for (const auto& texture : document.textures.Elements())
+    {
+        textures.push_back({
+            ResolveIndex(document.samplers, texture.samplerId),
+            ResolveIndex(document.images, texture.imageId)
+        });
+    }
+
+    defaultScene = ResolveIndex(document.scenes, document.defaultSceneId);
+}
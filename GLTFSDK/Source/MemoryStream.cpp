@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/MemoryStream.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+#ifdef _WIN32
+    std::shared_ptr<const uint8_t> MapFileData(const std::string& path, size_t& byteLength)
+    {
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw GLTFException("Unable to open file " + path);
+        }
+
+        LARGE_INTEGER fileSize;
+
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            throw GLTFException("Unable to query the size of file " + path);
+        }
+
+        byteLength = static_cast<size_t>(fileSize.QuadPart);
+
+        // Zero length files can't be mapped
+        if (byteLength == 0U)
+        {
+            CloseHandle(file);
+            return {};
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (!mapping)
+        {
+            throw GLTFException("Unable to create a file mapping for " + path);
+        }
+
+        auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);// The view keeps the mapping object alive
+
+        if (!view)
+        {
+            throw GLTFException("Unable to map a view of file " + path);
+        }
+
+        return std::shared_ptr<const uint8_t>(static_cast<const uint8_t*>(view), [](const uint8_t* data)
+        {
+            UnmapViewOfFile(data);
+        });
+    }
+#else
+    std::shared_ptr<const uint8_t> MapFileData(const std::string& path, size_t& byteLength)
+    {
+        const int fd = open(path.c_str(), O_RDONLY);
+
+        if (fd == -1)
+        {
+            throw GLTFException("Unable to open file " + path);
+        }
+
+        struct stat fileStat;
+
+        if (fstat(fd, &fileStat) != 0)
+        {
+            close(fd);
+            throw GLTFException("Unable to query the size of file " + path);
+        }
+
+        byteLength = static_cast<size_t>(fileStat.st_size);
+
+        // Zero length files can't be mapped
+        if (byteLength == 0U)
+        {
+            close(fd);
+            return {};
+        }
+
+        void* data = mmap(nullptr, byteLength, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);// The mapping keeps its own reference to the file
+
+        if (data == MAP_FAILED)
+        {
+            throw GLTFException("Unable to map file " + path);
+        }
+
+        return std::shared_ptr<const uint8_t>(static_cast<const uint8_t*>(data), [byteLength](const uint8_t* data)
+        {
+            munmap(const_cast<uint8_t*>(data), byteLength);
+        });
+    }
+#endif
+}
+
+std::shared_ptr<MemoryStream> MemoryStream::MapFile(const std::string& path)
+{
+    size_t byteLength = 0U;
+    auto data = MapFileData(path, byteLength);
+    return std::make_shared<MemoryStream>(std::move(data), byteLength);
+}
@@ -7,9 +7,18 @@
 #include <GLTFSDK/GLTFResourceReader.h>
 #include <GLTFSDK/BufferBuilder.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <numeric>
 
+// SSE2 is part of the x64 baseline (and of any x86 build targeting it) so no runtime detection is required. Other
+// architectures use the scalar loops, which are written so that compilers can auto-vectorize them.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLTFSDK_CONVERT_SSE2
+#include <emmintrin.h>
+#endif
+
 using namespace Microsoft::glTF;
 
 namespace
@@ -26,292 +35,413 @@ namespace
             static_cast<uint64_t>(short0);
     }
 
-    uint64_t ToUint64(const uint8_t byte0, const uint8_t byte1, const uint8_t byte2, const uint8_t byte3)
-    {
-        return
-            static_cast<uint64_t>(byte3) << 48UL |
-            static_cast<uint64_t>(byte2) << 32UL |
-            static_cast<uint64_t>(byte1) << 16UL |
-            static_cast<uint64_t>(byte0);
-    }
-
-    uint32_t ToUint32(const uint8_t byte0, const uint8_t byte1, const uint8_t byte2, const uint8_t byte3)
-    {
-        return
-            static_cast<uint32_t>(byte3) << 24U |
-            static_cast<uint32_t>(byte2) << 16U |
-            static_cast<uint32_t>(byte1) <<  8U |
-            static_cast<uint32_t>(byte0);
-    }
-
     uint8_t ToUint8(const uint16_t value)
     {
         return static_cast<uint8_t>(round((value / FLOAT_UINT16_MAX) * FLOAT_UINT8_MAX));
     }
 
-    template<typename TIn, typename TOut>
-    std::vector<TOut> ReadIndices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    // The conversion kernels below each convert count tightly packed components. The vector paths produce exactly the
+    // same results as the scalar ones: the same float operations are used, in the same order, and rounding is done
+    // explicitly rather than with the current rounding mode.
+    //
+    // Packed outputs (colors, joints and weights) are written as bytes, relying on the host being little-endian so that
+    // the bytes r, g, b, a form the value a << 24 | b << 16 | g << 8 | r. The reader relies on this for all binary data.
+
+    // Normalizes unsigned integer components to floats in [0, 1]
+    void NormalizeToFloat(const uint8_t* src, size_t count, float* dst)
     {
-        assert(sizeof(TOut) > sizeof(TIn));
+        size_t i = 0U;
 
-        const auto indices = reader.ReadBinaryData<TIn>(doc, accessor);
-        return std::vector<TOut>(indices.begin(), indices.end());
+#ifdef GLTFSDK_CONVERT_SSE2
+        const __m128 scale = _mm_set1_ps(FLOAT_UINT8_MAX);
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16U <= count; i += 16U)
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+
+            _mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+            _mm_storeu_ps(dst + i + 4U, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+            _mm_storeu_ps(dst + i + 8U, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+            _mm_storeu_ps(dst + i + 12U, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            dst[i] = src[i] / FLOAT_UINT8_MAX;
+        }
     }
 
-    std::vector<uint32_t> PackColorsRGBA(const std::vector<float>& colors)
+    void NormalizeToFloat(const uint16_t* src, size_t count, float* dst)
     {
-        assert(colors.size() % 4 == 0);
+        size_t i = 0U;
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 4);
+#ifdef GLTFSDK_CONVERT_SSE2
+        const __m128 scale = _mm_set1_ps(FLOAT_UINT16_MAX);
+        const __m128i zero = _mm_setzero_si128();
 
-        for (size_t i = 0; i < colors.size(); i += 4)
+        for (; i + 8U <= count; i += 8U)
         {
-            colors32.push_back(Color4(colors[i], colors[i + 1], colors[i + 2], colors[i + 3]).AsUint32RGBA());
+            const __m128i shorts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+            _mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(shorts, zero)), scale));
+            _mm_storeu_ps(dst + i + 4U, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(shorts, zero)), scale));
         }
+#endif
 
-        return colors32;
+        for (; i < count; ++i)
+        {
+            dst[i] = src[i] / FLOAT_UINT16_MAX;
+        }
     }
 
-    std::vector<uint32_t> PackColorsRGB(const std::vector<float>& colors)
+    // Zero extends unsigned integer components
+    void Widen(const uint8_t* src, size_t count, uint16_t* dst)
     {
-        assert(colors.size() % 3 == 0);
+        size_t i = 0U;
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 3);
+#ifdef GLTFSDK_CONVERT_SSE2
+        const __m128i zero = _mm_setzero_si128();
 
-        for (size_t i = 0; i < colors.size(); i += 3)
+        for (; i + 16U <= count; i += 16U)
         {
-            colors32.push_back(Color4(colors[i], colors[i + 1], colors[i + 2], 1.0f).AsUint32RGBA());
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8U), _mm_unpackhi_epi8(bytes, zero));
         }
+#endif
 
-        return colors32;
+        for (; i < count; ++i)
+        {
+            dst[i] = src[i];
+        }
     }
 
-    std::vector<uint32_t> PackColorsRGBA(const std::vector<uint8_t>& colors)
+    void Widen(const uint8_t* src, size_t count, uint32_t* dst)
     {
-        assert(colors.size() % 4 == 0);
+        size_t i = 0U;
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 4);
+#ifdef GLTFSDK_CONVERT_SSE2
+        const __m128i zero = _mm_setzero_si128();
 
-        for (size_t i = 0; i < colors.size(); i += 4)
+        for (; i + 16U <= count; i += 16U)
         {
-            uint8_t r = colors[i];
-            uint8_t g = colors[i + 1];
-            uint8_t b = colors[i + 2];
-            uint8_t a = colors[i + 3];
-            uint32_t rgba = ToUint32(r, g, b, a);
-            colors32.push_back(rgba);
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4U), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8U), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 12U), _mm_unpackhi_epi16(hi, zero));
         }
+#endif
 
-        return colors32;
+        for (; i < count; ++i)
+        {
+            dst[i] = src[i];
+        }
     }
 
-    std::vector<uint32_t> PackColorsRGB(const std::vector<uint8_t>& colors)
+    void Widen(const uint16_t* src, size_t count, uint32_t* dst)
     {
-        assert(colors.size() % 3 == 0);
+        size_t i = 0U;
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 3);
+#ifdef GLTFSDK_CONVERT_SSE2
+        const __m128i zero = _mm_setzero_si128();
 
-        for (size_t i = 0; i < colors.size(); i += 3)
+        for (; i + 8U <= count; i += 8U)
         {
-            uint8_t r = colors[i];
-            uint8_t g = colors[i + 1];
-            uint8_t b = colors[i + 2];
-            uint32_t rgba = ToUint32(r, g, b, 255);
-            colors32.push_back(rgba);
+            const __m128i shorts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi16(shorts, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4U), _mm_unpackhi_epi16(shorts, zero));
         }
+#endif
 
-        return colors32;
+        for (; i < count; ++i)
+        {
+            dst[i] = src[i];
+        }
     }
 
-    std::vector<uint32_t> PackColorsRGBA(const std::vector<uint16_t>& colors)
+    // Packs each group of four joint indices into 64 bits as 16-bit values
+    void PackJoints64(const uint8_t* src, size_t jointsCount, uint64_t* dst)
     {
-        assert(colors.size() % 4 == 0);
+        size_t i = 0U;
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 4);
+#ifdef GLTFSDK_CONVERT_SSE2
+        const __m128i zero = _mm_setzero_si128();
 
-        for (size_t i = 0; i < colors.size(); i += 4)
+        for (; i + 4U <= jointsCount; i += 4U)
         {
-            uint8_t r = ToUint8(colors[i]);
-            uint8_t g = ToUint8(colors[i + 1]);
-            uint8_t b = ToUint8(colors[i + 2]);
-            uint8_t a = ToUint8(colors[i + 3]);
-            uint32_t rgba = ToUint32(r, g, b, a);
-            colors32.push_back(rgba);
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4U));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 2U), _mm_unpackhi_epi8(bytes, zero));
         }
+#endif
 
-        return colors32;
+        for (; i < jointsCount; ++i)
+        {
+            const uint8_t* joints = src + i * 4U;
+            dst[i] = ToUint64(joints[0], joints[1], joints[2], joints[3]);
+        }
     }
 
-    std::vector<uint32_t> PackColorsRGB(const std::vector<uint16_t>& colors)
+    void PackJoints64(const uint16_t* src, size_t jointsCount, uint64_t* dst)
     {
-        assert(colors.size() % 3 == 0);
+        std::memcpy(dst, src, jointsCount * sizeof(uint64_t));
+    }
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 3);
+#ifdef GLTFSDK_CONVERT_SSE2
+    // Packs the low byte of each 32-bit lane of four vectors into 16 bytes
+    __m128i PackLowBytes(__m128i a, __m128i b, __m128i c, __m128i d)
+    {
+        const __m128i mask = _mm_set1_epi32(0xFF);
 
-        for (size_t i = 0; i < colors.size(); i += 3)
-        {
-            uint8_t r = ToUint8(colors[i]);
-            uint8_t g = ToUint8(colors[i + 1]);
-            uint8_t b = ToUint8(colors[i + 2]);
-            uint32_t rgba = ToUint32(r, g, b, 255);
-            colors32.push_back(rgba);
-        }
+        const __m128i ab = _mm_packs_epi32(_mm_and_si128(a, mask), _mm_and_si128(b, mask));
+        const __m128i cd = _mm_packs_epi32(_mm_and_si128(c, mask), _mm_and_si128(d, mask));
 
-        return colors32;
+        return _mm_packus_epi16(ab, cd);
     }
 
-    template<typename T>
-    std::vector<uint32_t> ReadColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    // Math::FloatToByte, i.e. truncating value * 255 + 0.5
+    __m128i FloatToByte(__m128 value)
     {
-        std::vector<T> colors = reader.ReadBinaryData<T>(doc, accessor);
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+    }
 
-        switch (accessor.type)
+    // ToUint8, i.e. rounding (value / 65535) * 255 to the nearest integer with halfway cases rounded up
+    __m128i ToUint8(__m128 value)
+    {
+        const __m128 scaled = _mm_mul_ps(_mm_div_ps(value, _mm_set1_ps(FLOAT_UINT16_MAX)), _mm_set1_ps(FLOAT_UINT8_MAX));
+        const __m128i truncated = _mm_cvttps_epi32(scaled);
+        const __m128 fraction = _mm_sub_ps(scaled, _mm_cvtepi32_ps(truncated));
+
+        // The comparison's all-ones mask is -1, so subtracting it adds one
+        return _mm_sub_epi32(truncated, _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f))));
+    }
+#endif
+
+    // Converts color and weight components to 8-bit unsigned normalized values
+    void ToUnorm8(const float* src, size_t count, uint8_t* dst)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+        for (; i + 16U <= count; i += 16U)
         {
-        case TYPE_VEC4:
-            return PackColorsRGBA(colors);
+            const __m128i bytes = PackLowBytes(
+                FloatToByte(_mm_loadu_ps(src + i)),
+                FloatToByte(_mm_loadu_ps(src + i + 4U)),
+                FloatToByte(_mm_loadu_ps(src + i + 8U)),
+                FloatToByte(_mm_loadu_ps(src + i + 12U)));
 
-        case TYPE_VEC3:
-            return PackColorsRGB(colors);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bytes);
+        }
+#endif
 
-        default:
-            throw GLTFException("Invalid type for color accessor " + accessor.id);
+        for (; i < count; ++i)
+        {
+            dst[i] = Math::FloatToByte(src[i]);
         }
     }
 
-    std::vector<float> ReadTexCoords(const std::vector<float>&& texcoords)
+    void ToUnorm8(const uint8_t* src, size_t count, uint8_t* dst)
     {
-        return std::move(texcoords);
+        std::memcpy(dst, src, count);
     }
 
-    std::vector<float> ReadTexCoords(const std::vector<uint8_t>&& texcoords)
+    void ToUnorm8(const uint16_t* src, size_t count, uint8_t* dst)
     {
-        std::vector<float> texcoordsFloat;
-        texcoordsFloat.reserve(texcoords.size());
-        for (size_t i = 0; i < texcoords.size(); i++)
+        size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16U <= count; i += 16U)
         {
-            texcoordsFloat.push_back(texcoords[i] / FLOAT_UINT8_MAX);
+            const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8U));
+
+            const __m128i bytes = PackLowBytes(
+                ToUint8(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero))),
+                ToUint8(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero))),
+                ToUint8(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero))),
+                ToUint8(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero))));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bytes);
         }
-        return texcoordsFloat;
-    }
+#endif
 
-    std::vector<float> ReadTexCoords(const std::vector<uint16_t>&& texcoords)
-    {
-        std::vector<float> texcoordsFloat;
-        texcoordsFloat.reserve(texcoords.size());
-        for (size_t i = 0; i < texcoords.size(); i++)
+        for (; i < count; ++i)
         {
-            texcoordsFloat.push_back(texcoords[i] / FLOAT_UINT16_MAX);
+            dst[i] = ToUint8(src[i]);
         }
-        return texcoordsFloat;
     }
 
+    // Converts RGB color components to RGBA colors with an alpha of 255. The components are converted in blocks on the
+    // stack and then expanded, so the conversion itself still runs over long contiguous runs.
     template<typename T>
-    std::vector<float> ReadTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    void ToUnorm8RGBA(const T* src, size_t colorCount, uint8_t* dst)
     {
-        std::vector<T> texcoords = reader.ReadBinaryData<T>(doc, accessor);
-        return ReadTexCoords(std::move(texcoords));
+        constexpr size_t blockColorCount = 256U;
+
+        uint8_t rgb[blockColorCount * 3U];
+
+        for (size_t colorsConverted = 0U; colorsConverted < colorCount;)
+        {
+            const size_t blockCount = std::min(blockColorCount, colorCount - colorsConverted);
+
+            ToUnorm8(src + colorsConverted * 3U, blockCount * 3U, rgb);
+
+            for (size_t i = 0U; i < blockCount; ++i, dst += 4U)
+            {
+                dst[0] = rgb[i * 3U];
+                dst[1] = rgb[i * 3U + 1U];
+                dst[2] = rgb[i * 3U + 2U];
+                dst[3] = std::numeric_limits<uint8_t>::max();
+            }
+
+            colorsConverted += blockCount;
+        }
     }
 
-    std::vector<uint32_t> ReadJoints32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    void ValidateCapacity(const Accessor& accessor, size_t requiredCount, size_t count)
     {
-        std::vector<uint8_t> joints = reader.ReadBinaryData<uint8_t>(doc, accessor);
-        std::vector<uint32_t> joints32;
-        joints32.reserve(joints.size() / 4);
-        for (size_t i = 0; i < joints.size(); i += 4)
+        if (count < requiredCount)
         {
-            joints32.push_back(ToUint32(joints[i], joints[i + 1], joints[i + 2], joints[i + 3]));
+            throw GLTFException("The destination is too small for the data of accessor " + accessor.id);
         }
-        return joints32;
     }
 
-    std::vector<uint64_t> ReadJoints64(const std::vector<uint8_t>& joints)
+    // Sizes a vector for the converted data of an accessor. The accessor is validated first as its count hasn't
+    // necessarily been checked against the size of its buffer view yet.
+    template<typename T>
+    std::vector<T> MakeOutput(const Document& doc, const Accessor& accessor, size_t countPerElement)
+    {
+        Validation::ValidateAccessor(doc, accessor);
+
+        return std::vector<T>(accessor.count * countPerElement);
+    }
+
+    // Reads the accessor's data as TIn and calls convert(src, elementCount, dst) to convert tightly packed elements
+    // into data, each element producing countPerElement values of TOut. When the buffer's data is resident in memory the
+    // elements are converted directly from it in a single call, unless they're interleaved, in which case they're
+    // gathered into blocks first. Otherwise the elements are converted from a single packed copy of the accessor's data.
+    template<typename TIn, typename TOut, typename Fn>
+    size_t ReadConverted(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, size_t countPerElement, TOut* data, size_t count, Fn convert)
     {
-        std::vector<uint64_t> joints64;
-        joints64.reserve(joints.size() / 4);
-        for (size_t i = 0; i < joints.size(); i += 4)
+        const size_t requiredCount = accessor.count * countPerElement;
+
+        ValidateCapacity(accessor, requiredCount, count);
+
+        const auto view = reader.ReadBinaryDataView<TIn>(doc, accessor);
+
+        if (view.IsContiguous())
         {
-            joints64.push_back(ToUint64(joints[i], joints[i + 1], joints[i + 2], joints[i + 3]));
+            convert(view.Data(), view.GetCount(), data);
+        }
+        else
+        {
+            const size_t typeCount = view.GetTypeCount();
+            const size_t blockElementCount = 1024U;
+
+            std::vector<TIn> block(blockElementCount * typeCount);
+
+            for (size_t elementsConverted = 0U; elementsConverted < view.GetCount();)
+            {
+                const size_t blockCount = std::min(blockElementCount, view.GetCount() - elementsConverted);
+
+                for (size_t i = 0U; i < blockCount; ++i)
+                {
+                    std::memcpy(block.data() + i * typeCount, view.GetElement(elementsConverted + i), typeCount * sizeof(TIn));
+                }
+
+                convert(block.data(), blockCount, data + elementsConverted * countPerElement);
+
+                elementsConverted += blockCount;
+            }
         }
-        return joints64;
+
+        return requiredCount;
     }
 
-    std::vector<uint64_t> ReadJoints64(const std::vector<uint16_t>& joints)
+    template<typename TIn, typename TOut>
+    size_t ReadIndices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, TOut* data, size_t count)
     {
-        std::vector<uint64_t> joints64;
-        joints64.reserve(joints.size() / 4);
-        for (size_t i = 0; i < joints.size(); i += 4)
+        assert(sizeof(TOut) > sizeof(TIn));
+
+        return ReadConverted<TIn>(doc, reader, accessor, 1U, data, count, [](const TIn* src, size_t indexCount, TOut* dst)
         {
-            joints64.push_back(ToUint64(joints[i], joints[i + 1], joints[i + 2], joints[i + 3]));
-        }
-        return joints64;
+            Widen(src, indexCount, dst);
+        });
     }
 
     template<typename T>
-    std::vector<uint64_t> ReadJoints64(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    size_t ReadColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count)
     {
-        std::vector<T> joints = reader.ReadBinaryData<T>(doc, accessor);
-        return ReadJoints64(joints);
+        switch (accessor.type)
+        {
+        case TYPE_VEC4:
+            return ReadConverted<T>(doc, reader, accessor, 1U, data, count, [](const T* src, size_t colorCount, uint32_t* dst)
+            {
+                ToUnorm8(src, colorCount * 4U, reinterpret_cast<uint8_t*>(dst));
+            });
+
+        case TYPE_VEC3:
+            return ReadConverted<T>(doc, reader, accessor, 1U, data, count, [](const T* src, size_t colorCount, uint32_t* dst)
+            {
+                ToUnorm8RGBA(src, colorCount, reinterpret_cast<uint8_t*>(dst));
+            });
+
+        default:
+            throw GLTFException("Invalid type for color accessor " + accessor.id);
+        }
     }
 
-    std::vector<uint32_t> ReadWeights32(const std::vector<float>&& weights)
+    template<typename T>
+    size_t ReadTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t count)
     {
-        std::vector<uint32_t> weights32;
-        weights32.reserve(weights.size() / 4);
-        for (size_t i = 0; i < weights.size(); i += 4)
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
+
+        return ReadConverted<T>(doc, reader, accessor, typeCount, data, count, [typeCount](const T* src, size_t texcoordCount, float* dst)
         {
-            weights32.push_back(
-                ToUint32(
-                    Math::FloatToByte(weights[i]),
-                    Math::FloatToByte(weights[i + 1]),
-                    Math::FloatToByte(weights[i + 2]),
-                    Math::FloatToByte(weights[i + 3])));
-        }
-        return weights32;
+            NormalizeToFloat(src, texcoordCount * typeCount, dst);
+        });
     }
 
-    std::vector<uint32_t> ReadWeights32(const std::vector<uint8_t>&& weights)
+    size_t ReadJoints32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count)
     {
-        std::vector<uint32_t> weights32;
-        weights32.reserve(weights.size() / 4);
-        for (size_t i = 0; i < weights.size(); i += 4)
+        // Four 8-bit joint indices are packed into 32 bits in the same order as they're stored
+        return ReadConverted<uint8_t>(doc, reader, accessor, 1U, data, count, [](const uint8_t* src, size_t jointsCount, uint32_t* dst)
         {
-            weights32.push_back(
-                ToUint32(
-                    weights[i],
-                    weights[i + 1],
-                    weights[i + 2],
-                    weights[i + 3]));
-        }
-        return weights32;
+            std::memcpy(dst, src, jointsCount * 4U);
+        });
     }
 
-    std::vector<uint32_t> ReadWeights32(const std::vector<uint16_t>&& weights)
+    template<typename T>
+    size_t ReadJoints64(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint64_t* data, size_t count)
     {
-        std::vector<uint32_t> weights32;
-        weights32.reserve(weights.size() / 4);
-        for (size_t i = 0; i < weights.size(); i += 4)
+        // Four joint indices are packed into 64 bits as 16-bit values
+        return ReadConverted<T>(doc, reader, accessor, 1U, data, count, [](const T* src, size_t jointsCount, uint64_t* dst)
         {
-            weights32.push_back(
-                ToUint32(
-                    ToUint8(weights[i]),
-                    ToUint8(weights[i + 1]),
-                    ToUint8(weights[i + 2]),
-                    ToUint8(weights[i + 3])));
-        }
-        return weights32;
+            PackJoints64(src, jointsCount, dst);
+        });
     }
 
     template<typename T>
-    std::vector<uint32_t> ReadWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    size_t ReadWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count)
     {
-        std::vector<T> weights = reader.ReadBinaryData<T>(doc, accessor);
-        return ReadWeights32(std::move(weights));
+        return ReadConverted<T>(doc, reader, accessor, 1U, data, count, [](const T* src, size_t weightsCount, uint32_t* dst)
+        {
+            ToUnorm8(src, weightsCount * 4U, reinterpret_cast<uint8_t*>(dst));
+        });
     }
 
     template<typename T>
@@ -635,6 +765,13 @@ namespace
 }
 
 std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    auto indices = MakeOutput<uint16_t>(doc, accessor, 1U);
+    GetIndices16(doc, reader, accessor, indices.data(), indices.size());
+    return indices;
+}
+
+size_t MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint16_t* data, size_t count)
 {
     if (accessor.type != TYPE_SCALAR)
     {
@@ -644,10 +781,10 @@ std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, cons
     switch (accessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadIndices<uint8_t, uint16_t>(doc, reader, accessor);
+        return ReadIndices<uint8_t, uint16_t>(doc, reader, accessor, data, count);
 
     case COMPONENT_UNSIGNED_SHORT:
-        return reader.ReadBinaryData<uint16_t>(doc, accessor);
+        return reader.ReadBinaryData<uint16_t>(doc, accessor, data, count);
 
     case COMPONENT_UNSIGNED_INT:
         throw GLTFException("Cannot convert 32-bit indices to 16-bit");
@@ -664,6 +801,13 @@ std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, cons
 }
 
 std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    auto indices = MakeOutput<uint32_t>(doc, accessor, 1U);
+    GetIndices32(doc, reader, accessor, indices.data(), indices.size());
+    return indices;
+}
+
+size_t MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t count)
 {
     if (accessor.type != TYPE_SCALAR)
     {
@@ -673,13 +817,13 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, cons
     switch (accessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadIndices<uint8_t, uint32_t>(doc, reader, accessor);
+        return ReadIndices<uint8_t, uint32_t>(doc, reader, accessor, data, count);
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadIndices<uint16_t, uint32_t>(doc, reader, accessor);
+        return ReadIndices<uint16_t, uint32_t>(doc, reader, accessor, data, count);
 
     case COMPONENT_UNSIGNED_INT:
-        return reader.ReadBinaryData<uint32_t>(doc, accessor);
+        return reader.ReadBinaryData<uint32_t>(doc, accessor, data, count);
 
     default:
         throw GLTFException("Invalid componentType for indices accessor " + accessor.id);
@@ -715,6 +859,13 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetSegmentedIndices32(const Document&
 
 // Positions
 std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor)
+{
+    auto positions = MakeOutput<float>(doc, positionsAccessor, 3U);
+    GetPositions(doc, reader, positionsAccessor, positions.data(), positions.size());
+    return positions;
+}
+
+size_t MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor, float* data, size_t count)
 {
     if (positionsAccessor.type != TYPE_VEC3)
     {
@@ -726,7 +877,7 @@ std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const G
         throw GLTFException("Invalid component type for positions accessor " + positionsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, positionsAccessor);
+    return reader.ReadBinaryData<float>(doc, positionsAccessor, data, count);
 }
 
 std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
@@ -743,6 +894,13 @@ std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const G
 
 // Normals
 std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor)
+{
+    auto normals = MakeOutput<float>(doc, normalsAccessor, 3U);
+    GetNormals(doc, reader, normalsAccessor, normals.data(), normals.size());
+    return normals;
+}
+
+size_t MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor, float* data, size_t count)
 {
     if (normalsAccessor.type != TYPE_VEC3)
     {
@@ -754,7 +912,7 @@ std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLT
         throw GLTFException("Invalid component type for normals accessor " + normalsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, normalsAccessor);
+    return reader.ReadBinaryData<float>(doc, normalsAccessor, data, count);
 }
 
 std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
@@ -771,6 +929,13 @@ std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLT
 
 // Tangents
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
+{
+    auto tangents = MakeOutput<float>(doc, tangentsAccessor, 4U);
+    GetTangents(doc, reader, tangentsAccessor, tangents.data(), tangents.size());
+    return tangents;
+}
+
+size_t MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, float* data, size_t count)
 {
     if (tangentsAccessor.type != TYPE_VEC4)
     {
@@ -782,7 +947,7 @@ std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GL
         throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, tangentsAccessor);
+    return reader.ReadBinaryData<float>(doc, tangentsAccessor, data, count);
 }
 
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
@@ -793,6 +958,13 @@ std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GL
 
 // Morph Target Tangents (which have a different accessor type than base mesh tangents)
 std::vector<float> MeshPrimitiveUtils::GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
+{
+    auto tangents = MakeOutput<float>(doc, tangentsAccessor, 3U);
+    GetMorphTangents(doc, reader, tangentsAccessor, tangents.data(), tangents.size());
+    return tangents;
+}
+
+size_t MeshPrimitiveUtils::GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, float* data, size_t count)
 {
     if (tangentsAccessor.type != TYPE_VEC3)
     {
@@ -804,7 +976,7 @@ std::vector<float> MeshPrimitiveUtils::GetMorphTangents(const Document& doc, con
         throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, tangentsAccessor);
+    return reader.ReadBinaryData<float>(doc, tangentsAccessor, data, count);
 }
 
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
@@ -815,17 +987,24 @@ std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GL
 
 // Texcoords
 std::vector<float> MeshPrimitiveUtils::GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    auto texcoords = MakeOutput<float>(doc, accessor, Accessor::GetTypeCount(accessor.type));
+    GetTexCoords(doc, reader, accessor, texcoords.data(), texcoords.size());
+    return texcoords;
+}
+
+size_t MeshPrimitiveUtils::GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t count)
 {
     switch (accessor.componentType)
     {
     case COMPONENT_FLOAT:
-        return ReadTexCoords<float>(doc, reader, accessor);
+        return reader.ReadBinaryData<float>(doc, accessor, data, count);
 
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadTexCoords<uint8_t>(doc, reader, accessor);
+        return ReadTexCoords<uint8_t>(doc, reader, accessor, data, count);
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadTexCoords<uint16_t>(doc, reader, accessor);
+        return ReadTexCoords<uint16_t>(doc, reader, accessor, data, count);
 
     default:
         throw GLTFException("Invalid componentType for texcoords accessor " + accessor.id);
@@ -846,17 +1025,24 @@ std::vector<float> MeshPrimitiveUtils::GetTexCoords_1(const Document& doc, const
 
 // Colors
 std::vector<uint32_t> MeshPrimitiveUtils::GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& colorsAccessor)
+{
+    auto colors = MakeOutput<uint32_t>(doc, colorsAccessor, 1U);
+    GetColors(doc, reader, colorsAccessor, colors.data(), colors.size());
+    return colors;
+}
+
+size_t MeshPrimitiveUtils::GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& colorsAccessor, uint32_t* data, size_t count)
 {
     switch (colorsAccessor.componentType)
     {
     case COMPONENT_FLOAT:
-        return ReadColors<float>(doc, reader, colorsAccessor);
+        return ReadColors<float>(doc, reader, colorsAccessor, data, count);
 
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadColors<uint8_t>(doc, reader, colorsAccessor);
+        return ReadColors<uint8_t>(doc, reader, colorsAccessor, data, count);
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadColors<uint16_t>(doc, reader, colorsAccessor);
+        return ReadColors<uint16_t>(doc, reader, colorsAccessor, data, count);
 
     default:
         throw GLTFException("Invalid componentType for color accessor " + colorsAccessor.id);
@@ -871,6 +1057,13 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetColors_0(const Document& doc, const
 
 // Joints
 std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor)
+{
+    auto joints = MakeOutput<uint32_t>(doc, jointsAccessor, 1U);
+    GetJointIndices32(doc, reader, jointsAccessor, joints.data(), joints.size());
+    return joints;
+}
+
+size_t MeshPrimitiveUtils::GetJointIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor, uint32_t* data, size_t count)
 {
     if (jointsAccessor.type != TYPE_VEC4)
     {
@@ -880,7 +1073,7 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32(const Document& doc,
     switch (jointsAccessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadJoints32(doc, reader, jointsAccessor);
+        return ReadJoints32(doc, reader, jointsAccessor, data, count);
 
     case COMPONENT_UNSIGNED_SHORT:
         throw GLTFException("Cannot pack 4 x 16-bit indices into 32-bits");
@@ -897,6 +1090,13 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32_0(const Document& do
 }
 
 std::vector<uint64_t> MeshPrimitiveUtils::GetJointIndices64(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor)
+{
+    auto joints = MakeOutput<uint64_t>(doc, jointsAccessor, 1U);
+    GetJointIndices64(doc, reader, jointsAccessor, joints.data(), joints.size());
+    return joints;
+}
+
+size_t MeshPrimitiveUtils::GetJointIndices64(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor, uint64_t* data, size_t count)
 {
     if (jointsAccessor.type != TYPE_VEC4)
     {
@@ -906,10 +1106,10 @@ std::vector<uint64_t> MeshPrimitiveUtils::GetJointIndices64(const Document& doc,
     switch (jointsAccessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadJoints64<uint8_t>(doc, reader, jointsAccessor);
+        return ReadJoints64<uint8_t>(doc, reader, jointsAccessor, data, count);
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadJoints64<uint16_t>(doc, reader, jointsAccessor);
+        return ReadJoints64<uint16_t>(doc, reader, jointsAccessor, data, count);
 
     default:
         throw GLTFException("Invalid componentType for joints accessor " + jointsAccessor.id);
@@ -924,6 +1124,13 @@ std::vector<uint64_t> MeshPrimitiveUtils::GetJointIndices64_0(const Document& do
 
 // Weights
 std::vector<uint32_t> MeshPrimitiveUtils::GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& weightsAccessor)
+{
+    auto weights = MakeOutput<uint32_t>(doc, weightsAccessor, 1U);
+    GetJointWeights32(doc, reader, weightsAccessor, weights.data(), weights.size());
+    return weights;
+}
+
+size_t MeshPrimitiveUtils::GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& weightsAccessor, uint32_t* data, size_t count)
 {
     if (weightsAccessor.type != TYPE_VEC4)
     {
@@ -933,13 +1140,13 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetJointWeights32(const Document& doc,
     switch (weightsAccessor.componentType)
     {
     case COMPONENT_FLOAT:
-        return ReadWeights32<float>(doc, reader, weightsAccessor);
+        return ReadWeights32<float>(doc, reader, weightsAccessor, data, count);
 
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadWeights32<uint8_t>(doc, reader, weightsAccessor);
+        return ReadWeights32<uint8_t>(doc, reader, weightsAccessor, data, count);
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadWeights32<uint16_t>(doc, reader, weightsAccessor);
+        return ReadWeights32<uint16_t>(doc, reader, weightsAccessor, data, count);
 
     default:
         throw GLTFException("Invalid componentType for weights accessor " + weightsAccessor.id);
@@ -0,0 +1,604 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ResourceReaderUtils.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define GLTFSDK_BASE64_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define GLTFSDK_BASE64_NEON
+#include <arm_neon.h>
+#endif
+
+// Functions using instructions beyond the compiler's baseline must be annotated for GCC and Clang. MSVC allows any
+// intrinsic to be used without annotation.
+#if defined(GLTFSDK_BASE64_X86) && (defined(__GNUC__) || defined(__clang__))
+#define GLTFSDK_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#else
+#define GLTFSDK_TARGET(instructionSet)
+#endif
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    const uint8_t InvalidChar = std::numeric_limits<uint8_t>::max();
+
+    // A lookup table covering every possible char value avoids the range checks needed with a 128 entry table
+    std::array<uint8_t, 256> GetDecodeTable256()
+    {
+        std::array<uint8_t, 256> decodeTable;
+        decodeTable.fill(InvalidChar);
+
+        const auto decodeTable128 = GetDecodeTable();
+        std::copy(decodeTable128.begin(), decodeTable128.end(), decodeTable.begin());
+
+        return decodeTable;
+    }
+
+    const std::array<uint8_t, 256>& DecodeTable()
+    {
+        static const std::array<uint8_t, 256> decodeTable = GetDecodeTable256();
+        return decodeTable;
+    }
+
+    void ThrowInvalidChar()
+    {
+        throw GLTFException("Invalid base64 character");
+    }
+
+    // Decodes an arbitrary number of characters, one at a time, discarding the first bytesToSkip decoded bytes
+    void DecodeBits(const char* src, size_t charCount, uint8_t*& dst, size_t& bytesToSkip)
+    {
+        const auto& decodeTable = DecodeTable();
+
+        uint32_t block = 0U;
+        uint32_t blockBits = 0U;
+
+        for (size_t i = 0U; i < charCount; ++i)
+        {
+            const auto decodedChar = decodeTable[static_cast<uint8_t>(src[i])];
+
+            if (decodedChar == InvalidChar)
+            {
+                ThrowInvalidChar();
+            }
+
+            // Each character of a base64 string encodes 6 bits of data so left shift any remaining
+            // bits to accomodate another character's worth of data before performing a bitwise OR
+            block = (block << 6U) | decodedChar;
+            blockBits += 6U;
+
+            // If there are 8 or more bits stored in 'block' then write a single byte to the output buffer
+            if (blockBits >= 8U)
+            {
+                blockBits -= 8U;
+
+                if (bytesToSkip > 0U)
+                {
+                    bytesToSkip--;
+                }
+                else
+                {
+                    *(dst++) = static_cast<uint8_t>(block >> blockBits);
+                }
+
+                // Discard the bits of the byte just decoded
+                block &= (1U << blockBits) - 1U;
+            }
+        }
+    }
+
+    // Decodes groups of 4 characters into 3 bytes. The character count must be a multiple of 4.
+    void DecodeQuads(const char* src, size_t charCount, uint8_t*& dst)
+    {
+        const auto& decodeTable = DecodeTable();
+
+        for (const char* srcEnd = src + charCount; src != srcEnd; src += 4)
+        {
+            const uint32_t a = decodeTable[static_cast<uint8_t>(src[0])];
+            const uint32_t b = decodeTable[static_cast<uint8_t>(src[1])];
+            const uint32_t c = decodeTable[static_cast<uint8_t>(src[2])];
+            const uint32_t d = decodeTable[static_cast<uint8_t>(src[3])];
+
+            // Valid decoded characters never have the high bit set
+            if ((a | b | c | d) & 0x80U)
+            {
+                ThrowInvalidChar();
+            }
+
+            const uint32_t block = (a << 18U) | (b << 12U) | (c << 6U) | d;
+
+            dst[0] = static_cast<uint8_t>(block >> 16U);
+            dst[1] = static_cast<uint8_t>(block >> 8U);
+            dst[2] = static_cast<uint8_t>(block);
+
+            dst += 3;
+        }
+    }
+
+    void EncodeTriples(const uint8_t* src, size_t byteCount, char*& dst)
+    {
+        for (const uint8_t* srcEnd = src + byteCount; src != srcEnd; src += 3)
+        {
+            const uint32_t block = (static_cast<uint32_t>(src[0]) << 16U) | (static_cast<uint32_t>(src[1]) << 8U) | src[2];
+
+            dst[0] = characterSet[(block >> 18U) & 0x3FU];
+            dst[1] = characterSet[(block >> 12U) & 0x3FU];
+            dst[2] = characterSet[(block >> 6U) & 0x3FU];
+            dst[3] = characterSet[block & 0x3FU];
+
+            dst += 4;
+        }
+    }
+
+    // Vectorized decoders process as many characters as possible in whole blocks, returning the number of characters
+    // consumed (always a multiple of 4) and advancing dst. Encoders behave the same but return the number of bytes consumed.
+    typedef size_t(*FnDecode)(const char* src, size_t charCount, uint8_t*& dst);
+    typedef size_t(*FnEncode)(const uint8_t* src, size_t byteCount, char*& dst);
+
+    size_t DecodeNone(const char*, size_t, uint8_t*&)
+    {
+        return 0U;
+    }
+
+    size_t EncodeNone(const uint8_t*, size_t, char*&)
+    {
+        return 0U;
+    }
+
+#ifdef GLTFSDK_BASE64_X86
+
+    // The SSSE3 and AVX2 implementations are based on the pshufb lookup algorithms described by Wojciech Muła:
+    // http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html and http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+
+    GLTFSDK_TARGET("ssse3")
+    size_t DecodeSSSE3(const char* src, size_t charCount, uint8_t*& dst)
+    {
+        const __m128i lutLo = _mm_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m128i lutHi = _mm_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m128i lutRoll = _mm_setr_epi8(
+            0, 16, 19, 4, -65, -65, -71, -71,
+            0, 0, 0, 0, 0, 0, 0, 0);
+
+        const __m128i maskNibble = _mm_set1_epi8(0x0F);
+        const __m128i maskSlash = _mm_set1_epi8('/');
+
+        size_t charsRead = 0U;
+
+        // Each block reads 16 characters and writes 16 bytes, only 12 of which are decoded data. Require enough
+        // characters to remain after the block that the 4 bytes of overrun are always overwritten later.
+        while (charCount - charsRead >= 24U)
+        {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + charsRead));
+
+            const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), maskNibble);
+            const __m128i loNibbles = _mm_and_si128(in, maskNibble);
+
+            const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+            const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+
+            if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())))
+            {
+                ThrowInvalidChar();
+            }
+
+            const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(in, maskSlash), hiNibbles));
+            const __m128i sextets = _mm_add_epi8(in, roll);
+
+            // Pack the four 6-bit values in each 32-bit lane into 24 bits then gather the 3 bytes of each lane
+            const __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+            const __m128i out = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), out);
+
+            dst += 12;
+            charsRead += 16U;
+        }
+
+        return charsRead;
+    }
+
+    GLTFSDK_TARGET("avx2")
+    size_t DecodeAVX2(const char* src, size_t charCount, uint8_t*& dst)
+    {
+        const __m256i lutLo = _mm256_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m256i lutHi = _mm256_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m256i lutRoll = _mm256_setr_epi8(
+            0, 16, 19, 4, -65, -65, -71, -71,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 16, 19, 4, -65, -65, -71, -71,
+            0, 0, 0, 0, 0, 0, 0, 0);
+
+        const __m256i maskNibble = _mm256_set1_epi8(0x0F);
+        const __m256i maskSlash = _mm256_set1_epi8('/');
+
+        const __m256i shuffleBytes = _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+        const __m256i shuffleLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+        size_t charsRead = 0U;
+
+        // Each block reads 32 characters and writes 32 bytes, only 24 of which are decoded data (see DecodeSSSE3)
+        while (charCount - charsRead >= 44U)
+        {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + charsRead));
+
+            const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), maskNibble);
+            const __m256i loNibbles = _mm256_and_si256(in, maskNibble);
+
+            const __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+            const __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+
+            if (!_mm256_testz_si256(lo, hi))
+            {
+                ThrowInvalidChar();
+            }
+
+            const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(_mm256_cmpeq_epi8(in, maskSlash), hiNibbles));
+            const __m256i sextets = _mm256_add_epi8(in, roll);
+
+            const __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+            const __m256i out = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, shuffleBytes), shuffleLanes);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), out);
+
+            dst += 24;
+            charsRead += 32U;
+        }
+
+        return charsRead;
+    }
+
+    GLTFSDK_TARGET("ssse3")
+    size_t EncodeSSSE3(const uint8_t* src, size_t byteCount, char*& dst)
+    {
+        const __m128i shuffleBytes = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        const __m128i lutShift = _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+        size_t bytesRead = 0U;
+
+        // Each block reads 16 bytes but only encodes the first 12
+        while (byteCount - bytesRead >= 16U)
+        {
+            const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + bytesRead)), shuffleBytes);
+
+            // Split each group of 3 bytes into four 6-bit values, one per byte
+            const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+            const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+            const __m128i sextets = _mm_or_si128(t0, t1);
+
+            // Map each 6-bit value to the offset from the value to its character
+            __m128i index = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+            index = _mm_or_si128(index, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+
+            const __m128i out = _mm_add_epi8(_mm_shuffle_epi8(lutShift, index), sextets);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), out);
+
+            dst += 16;
+            bytesRead += 12U;
+        }
+
+        return bytesRead;
+    }
+
+    enum class SimdSupport
+    {
+        None,
+        SSSE3,
+        AVX2
+    };
+
+    SimdSupport GetSimdSupport()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SimdSupport::AVX2;
+        }
+
+        if (__builtin_cpu_supports("ssse3"))
+        {
+            return SimdSupport::SSSE3;
+        }
+#elif defined(_MSC_VER)
+        int info[4];
+
+        __cpuid(info, 0);
+        const int idCount = info[0];
+
+        __cpuid(info, 1);
+        const bool hasSSSE3 = (info[2] & (1 << 9)) != 0;
+        const bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+        const bool hasAVX = (info[2] & (1 << 28)) != 0;
+
+        bool hasAVX2 = false;
+
+        if (idCount >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            hasAVX2 = (info[1] & (1 << 5)) != 0;
+        }
+
+        // The OS must also save the AVX registers on context switches
+        if (hasAVX2 && hasAVX && hasOSXSAVE && ((_xgetbv(0) & 0x6) == 0x6))
+        {
+            return SimdSupport::AVX2;
+        }
+
+        if (hasSSSE3)
+        {
+            return SimdSupport::SSSE3;
+        }
+#endif
+        return SimdSupport::None;
+    }
+
+    FnDecode GetDecodeFunction()
+    {
+        switch (GetSimdSupport())
+        {
+        case SimdSupport::AVX2:
+            return DecodeAVX2;
+        case SimdSupport::SSSE3:
+            return DecodeSSSE3;
+        default:
+            return DecodeNone;
+        }
+    }
+
+    FnEncode GetEncodeFunction()
+    {
+        return GetSimdSupport() == SimdSupport::None ? EncodeNone : EncodeSSSE3;
+    }
+
+#elif defined(GLTFSDK_BASE64_NEON)
+
+    uint8x16_t TranslateNEON(uint8x16_t in, uint8x16_t& invalid)
+    {
+        const uint8x16_t isUpper = vcleq_u8(vsubq_u8(in, vdupq_n_u8('A')), vdupq_n_u8(25));
+        const uint8x16_t isLower = vcleq_u8(vsubq_u8(in, vdupq_n_u8('a')), vdupq_n_u8(25));
+        const uint8x16_t isDigit = vcleq_u8(vsubq_u8(in, vdupq_n_u8('0')), vdupq_n_u8(9));
+        const uint8x16_t isPlus = vceqq_u8(in, vdupq_n_u8('+'));
+        const uint8x16_t isSlash = vceqq_u8(in, vdupq_n_u8('/'));
+
+        uint8x16_t out = vandq_u8(isUpper, vsubq_u8(in, vdupq_n_u8('A')));
+        out = vorrq_u8(out, vandq_u8(isLower, vsubq_u8(in, vdupq_n_u8('a' - 26))));
+        out = vorrq_u8(out, vandq_u8(isDigit, vaddq_u8(in, vdupq_n_u8(52 - '0'))));
+        out = vorrq_u8(out, vandq_u8(isPlus, vdupq_n_u8(62)));
+        out = vorrq_u8(out, vandq_u8(isSlash, vdupq_n_u8(63)));
+
+        const uint8x16_t isValid = vorrq_u8(vorrq_u8(vorrq_u8(isUpper, isLower), vorrq_u8(isDigit, isPlus)), isSlash);
+        invalid = vorrq_u8(invalid, vmvnq_u8(isValid));
+
+        return out;
+    }
+
+    size_t DecodeNEON(const char* src, size_t charCount, uint8_t*& dst)
+    {
+        size_t charsRead = 0U;
+
+        // Each block de-interleaves 64 characters into four vectors (one per character of each group of 4) and writes 48 bytes
+        while (charCount - charsRead >= 64U)
+        {
+            const uint8x16x4_t in = vld4q_u8(reinterpret_cast<const uint8_t*>(src + charsRead));
+
+            uint8x16_t invalid = vdupq_n_u8(0);
+
+            const uint8x16_t a = TranslateNEON(in.val[0], invalid);
+            const uint8x16_t b = TranslateNEON(in.val[1], invalid);
+            const uint8x16_t c = TranslateNEON(in.val[2], invalid);
+            const uint8x16_t d = TranslateNEON(in.val[3], invalid);
+
+            if (vmaxvq_u8(invalid))
+            {
+                ThrowInvalidChar();
+            }
+
+            uint8x16x3_t out;
+            out.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+            out.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+            out.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+
+            vst3q_u8(dst, out);
+
+            dst += 48;
+            charsRead += 64U;
+        }
+
+        return charsRead;
+    }
+
+    size_t EncodeNEON(const uint8_t* src, size_t byteCount, char*& dst)
+    {
+        const auto characters = reinterpret_cast<const uint8_t*>(characterSet);
+
+        uint8x16x4_t lut;
+        lut.val[0] = vld1q_u8(characters);
+        lut.val[1] = vld1q_u8(characters + 16);
+        lut.val[2] = vld1q_u8(characters + 32);
+        lut.val[3] = vld1q_u8(characters + 48);
+        const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+        size_t bytesRead = 0U;
+
+        // Each block de-interleaves 48 bytes into three vectors (one per byte of each group of 3) and writes 64 characters
+        while (byteCount - bytesRead >= 48U)
+        {
+            const uint8x16x3_t in = vld3q_u8(src + bytesRead);
+
+            uint8x16x4_t out;
+            out.val[0] = vqtbl4q_u8(lut, vshrq_n_u8(in.val[0], 2));
+            out.val[1] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask));
+            out.val[2] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask));
+            out.val[3] = vqtbl4q_u8(lut, vandq_u8(in.val[2], mask));
+
+            vst4q_u8(reinterpret_cast<uint8_t*>(dst), out);
+
+            dst += 64;
+            bytesRead += 48U;
+        }
+
+        return bytesRead;
+    }
+
+    FnDecode GetDecodeFunction()
+    {
+        return DecodeNEON;// NEON is a required part of ARMv8-A so is always available
+    }
+
+    FnEncode GetEncodeFunction()
+    {
+        return EncodeNEON;
+    }
+
+#else
+
+    FnDecode GetDecodeFunction()
+    {
+        return DecodeNone;
+    }
+
+    FnEncode GetEncodeFunction()
+    {
+        return EncodeNone;
+    }
+
+#endif
+}
+
+void Microsoft::glTF::Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip)
+{
+    if (encodedData.GetByteCount() != (decodedData.bufferByteLength + bytesToSkip))
+    {
+        throw GLTFException("The specified decode buffer's size is incorrect");
+    }
+
+    size_t charCount = encodedData.GetCharCount();
+
+    if (charCount == 0U)
+    {
+        return;
+    }
+
+    static const FnDecode fnDecode = GetDecodeFunction();
+
+    const char* src = &*encodedData.itBegin;
+    uint8_t* dst = static_cast<uint8_t*>(decodedData.buffer);
+
+    // Decode the leading groups of 4 characters that contain the bytes to be skipped one character at a time, so
+    // that the remaining characters can be decoded in whole groups without needing to discard any output
+    if (bytesToSkip > 0U)
+    {
+        const size_t headCharCount = std::min(charCount, ((bytesToSkip + 2U) / 3U) * 4U);
+
+        DecodeBits(src, headCharCount, dst, bytesToSkip);
+
+        src += headCharCount;
+        charCount -= headCharCount;
+    }
+
+    const size_t vectorCharCount = fnDecode(src, charCount, dst);
+
+    src += vectorCharCount;
+    charCount -= vectorCharCount;
+
+    const size_t quadCharCount = charCount & ~static_cast<size_t>(3U);
+
+    DecodeQuads(src, quadCharCount, dst);
+    DecodeBits(src + quadCharCount, charCount - quadCharCount, dst, bytesToSkip);
+}
+
+std::string Microsoft::glTF::Base64Encode(const void* data, size_t byteLength)
+{
+    static const FnEncode fnEncode = GetEncodeFunction();
+
+    std::string encodedData(((byteLength + 2U) / 3U) * 4U, '=');
+
+    if (byteLength == 0U)
+    {
+        return encodedData;
+    }
+
+    auto src = static_cast<const uint8_t*>(data);
+    char* dst = &encodedData[0];
+
+    const size_t vectorByteCount = fnEncode(src, byteLength, dst);
+
+    src += vectorByteCount;
+    byteLength -= vectorByteCount;
+
+    const size_t tripleByteCount = byteLength - (byteLength % 3U);
+
+    EncodeTriples(src, tripleByteCount, dst);
+
+    src += tripleByteCount;
+    byteLength -= tripleByteCount;
+
+    // Encode the final 1 or 2 bytes, the remaining characters are already set to the '=' padding character
+    if (byteLength > 0U)
+    {
+        const uint32_t block = (static_cast<uint32_t>(src[0]) << 16U) | (byteLength > 1U ? (static_cast<uint32_t>(src[1]) << 8U) : 0U);
+
+        dst[0] = characterSet[(block >> 18U) & 0x3FU];
+        dst[1] = characterSet[(block >> 12U) & 0x3FU];
+
+        if (byteLength > 1U)
+        {
+            dst[2] = characterSet[(block >> 6U) & 0x3FU];
+        }
+    }
+
+    return encodedData;
+}
+
+std::vector<ByteRange> Microsoft::glTF::CoalesceByteRanges(std::vector<ByteRange> ranges, size_t maxGapByteLength)
+{
+    std::sort(ranges.begin(), ranges.end(), [](const ByteRange& lhs, const ByteRange& rhs)
+    {
+        return lhs.byteBegin < rhs.byteBegin;
+    });
+
+    std::vector<ByteRange> result;
+
+    for (const auto& range : ranges)
+    {
+        // Written to avoid overflow when adding maxGapByteLength to byteEnd
+        if (result.empty() || (range.byteBegin > result.back().byteEnd && range.byteBegin - result.back().byteEnd > maxGapByteLength))
+        {
+            result.push_back(range);
+        }
+        else
+        {
+            result.back().byteEnd = std::max(result.back().byteEnd, range.byteEnd);
+        }
+    }
+
+    return result;
+}
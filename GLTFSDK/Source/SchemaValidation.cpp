@@ -4,82 +4,108 @@
 #include <GLTFSDK/SchemaValidation.h>
 #include <GLTFSDK/Exceptions.h>
 
-#include <unordered_map>
-
 using namespace Microsoft::glTF;
 
-namespace
+SchemaDocumentProvider::SchemaDocumentProvider(std::unique_ptr<const ISchemaLocator> schemaLocator) : m_schemaLocator(std::move(schemaLocator))
 {
-    class RemoteSchemaDocumentProvider : public rapidjson::IRemoteSchemaDocumentProvider
+    if (!m_schemaLocator)
     {
-    public:
-        RemoteSchemaDocumentProvider(std::unique_ptr<const ISchemaLocator> schemaLocator) : schemaLocator(std::move(schemaLocator))
-        {
-            assert(this->schemaLocator);
-        }
+        throw GLTFException("ISchemaLocator instance must not be null");
+    }
+}
 
-        const rapidjson::SchemaDocument* GetRemoteDocument(const std::string& uri)
-        {
-            auto itDoc = schemaDocuments.find(uri);
+const rapidjson::SchemaDocument& SchemaDocumentProvider::GetSchemaDocument(const std::string& uri)
+{
+    auto itDoc = m_schemaDocuments.find(uri);
 
-            if (itDoc != schemaDocuments.end())
-            {
-                return &(itDoc->second);
-            }
+    if (itDoc != m_schemaDocuments.end())
+    {
+        return itDoc->second;
+    }
 
-            rapidjson::Document document;
+    const char* schemaContent = m_schemaLocator->GetSchemaContent(uri);
 
-            if (document.Parse(schemaLocator->GetSchemaContent(uri)).HasParseError())
-            {
-                throw GLTFException("Schema document at " + uri + " is not valid JSON");
-            }
+    if (!schemaContent)
+    {
+        throw GLTFException("Schema document at " + uri + " could not be located");
+    }
 
-            auto result = schemaDocuments.emplace(uri, rapidjson::SchemaDocument(document, this));
-            assert(result.second);
-            auto resultSchemaDoc = &(result.first->second);
-            assert(resultSchemaDoc);
+    rapidjson::Document document;
 
-            return resultSchemaDoc;
-        }
+    if (document.Parse(schemaContent).HasParseError())
+    {
+        throw GLTFException("Schema document at " + uri + " is not valid JSON");
+    }
 
-        const rapidjson::SchemaDocument* GetRemoteDocument(const char* uri, rapidjson::SizeType length) override
-        {
-            return GetRemoteDocument({ uri, length });
-        }
+    auto result = m_schemaDocuments.emplace(uri, rapidjson::SchemaDocument(document, this));
+    assert(result.second);
 
-        const std::unique_ptr<const ISchemaLocator> schemaLocator;
+    return result.first->second;
+}
 
-    private:
-        std::unordered_map<std::string, rapidjson::SchemaDocument> schemaDocuments;
-    };
+const rapidjson::SchemaDocument* SchemaDocumentProvider::GetRemoteDocument(const char* uri, rapidjson::SizeType length)
+{
+    return &GetSchemaDocument({ uri, length });
 }
 
 void Microsoft::glTF::ValidateDocumentAgainstSchema(const rapidjson::Document& document, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator)
 {
-    if (!schemaLocator)
+    CompiledSchema(std::move(schemaLocator), schemaUri).Validate(document);
+}
+
+CompiledSchema::CompiledSchema(std::unique_ptr<const ISchemaLocator> schemaLocator, const std::string& schemaUri) :
+    m_provider(std::move(schemaLocator)),
+    m_schemaDocument(m_provider.GetSchemaDocument(schemaUri))
+{
+}
+
+void CompiledSchema::Validate(const rapidjson::Document& document) const
+{
+    rapidjson::SchemaValidator schemaValidator(m_schemaDocument);
+
+    if (!document.Accept(schemaValidator))
     {
-        throw GLTFException("ISchemaLocator instance must not be null");
+        ThrowSchemaViolation(schemaValidator);
     }
+}
+
+const std::shared_ptr<SchemaCache>& SchemaCache::GetProcessCache()
+{
+    static const std::shared_ptr<SchemaCache> processCache = std::make_shared<SchemaCache>();
+    return processCache;
+}
 
-    RemoteSchemaDocumentProvider provider(std::move(schemaLocator));
+std::shared_ptr<const CompiledSchema> SchemaCache::Get(SchemaFlags schemaFlags)
+{
+    const auto key = static_cast<std::underlying_type_t<SchemaFlags>>(schemaFlags);
 
-    if (auto* schemaDocument = provider.GetRemoteDocument(schemaUri))
     {
-        rapidjson::SchemaValidator schemaValidator(*schemaDocument);
+        std::lock_guard<std::mutex> lock(m_mutex);
 
-        if (!document.Accept(schemaValidator))
-        {
-            rapidjson::StringBuffer sb;
-
-            const std::string schemaKeyword = schemaValidator.GetInvalidSchemaKeyword();
-            schemaValidator.GetInvalidDocumentPointer().StringifyUriFragment(sb);
-            const std::string schemaInvalid = sb.GetString();
+        auto it = m_schemas.find(key);
 
-            throw ValidationException("Schema violation at " + schemaInvalid + " due to " + schemaKeyword);
+        if (it != m_schemas.end())
+        {
+            return it->second;
         }
     }
-    else
-    {
-        throw GLTFException("Schema document at " + schemaUri + " could not be located");
-    }
+
+    // Compile the schema without holding the lock, if another thread compiles the same flags first its schema is used
+    auto schema = std::make_shared<const CompiledSchema>(GetDefaultSchemaLocator(schemaFlags));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_schemas.emplace(key, std::move(schema)).first->second;
+}
+
+size_t SchemaCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_schemas.size();
+}
+
+void SchemaCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_schemas.clear();
 }
@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/SharedResourceCache.h>
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+constexpr size_t SharedResourceCache::DefaultByteBudget;
+
+namespace
+{
+    std::shared_ptr<const std::vector<uint8_t>> ReadFileData(const std::string& path, size_t byteCount)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file)
+        {
+            throw GLTFException("Unable to open file " + path);
+        }
+
+        auto data = std::make_shared<std::vector<uint8_t>>(byteCount);
+
+        if (!file.read(reinterpret_cast<char*>(data->data()), static_cast<std::streamsize>(byteCount)))
+        {
+            throw GLTFException("Unable to read from file " + path);
+        }
+
+        return data;
+    }
+}
+
+SharedResourceCache::SharedResourceCache(size_t byteBudget) :
+    m_cache(byteBudget, [](const CachedFile& file) { return file.data->size(); })
+{
+}
+
+const std::shared_ptr<SharedResourceCache>& SharedResourceCache::GetProcessCache()
+{
+    static const std::shared_ptr<SharedResourceCache> processCache = std::make_shared<SharedResourceCache>(DefaultByteBudget);
+    return processCache;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> SharedResourceCache::Get(const std::string& path)
+{
+    const std::string resolvedPath = ResolvePath(path);
+    const FileIdentity identity = GetFileIdentity(resolvedPath);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (auto data = Find(resolvedPath, identity))
+        {
+            m_cache.RecordHit();
+            return data;
+        }
+
+        m_cache.RecordMiss();
+    }
+
+    auto data = ReadFileData(resolvedPath, static_cast<size_t>(identity.byteCount));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Another thread may have cached the same file while it was being read
+    if (auto cachedData = Find(resolvedPath, identity))
+    {
+        return cachedData;
+    }
+
+    m_cache.Insert(resolvedPath, { identity, data });
+
+    return data;
+}
+
+void SharedResourceCache::SetByteBudget(size_t byteBudget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.SetByteBudget(byteBudget);
+}
+
+size_t SharedResourceCache::GetByteBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.GetByteBudget();
+}
+
+size_t SharedResourceCache::GetByteCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.GetByteCount();
+}
+
+SharedResourceCacheStats SharedResourceCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.GetStats();
+}
+
+size_t SharedResourceCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.Size();
+}
+
+void SharedResourceCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.Clear();
+}
+
+#ifdef _WIN32
+std::string SharedResourceCache::ResolvePath(const std::string& path)
+{
+    char resolvedPath[MAX_PATH];
+
+    const DWORD length = GetFullPathNameA(path.c_str(), MAX_PATH, resolvedPath, nullptr);
+
+    if (length == 0U || length >= MAX_PATH)
+    {
+        throw GLTFException("Unable to resolve the path of file " + path);
+    }
+
+    return std::string(resolvedPath, length);
+}
+
+FileIdentity SharedResourceCache::GetFileIdentity(const std::string& resolvedPath)
+{
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+
+    if (!GetFileAttributesExA(resolvedPath.c_str(), GetFileExInfoStandard, &attributes))
+    {
+        throw GLTFException("Unable to query the attributes of file " + resolvedPath);
+    }
+
+    const uint64_t byteCount = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    const uint64_t modifiedTime = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+
+    return { byteCount, static_cast<int64_t>(modifiedTime) };
+}
+#else
+std::string SharedResourceCache::ResolvePath(const std::string& path)
+{
+    char resolvedPath[PATH_MAX];
+
+    if (!realpath(path.c_str(), resolvedPath))
+    {
+        throw GLTFException("Unable to resolve the path of file " + path);
+    }
+
+    return resolvedPath;
+}
+
+FileIdentity SharedResourceCache::GetFileIdentity(const std::string& resolvedPath)
+{
+    struct stat fileStat;
+
+    if (stat(resolvedPath.c_str(), &fileStat) != 0)
+    {
+        throw GLTFException("Unable to query the attributes of file " + resolvedPath);
+    }
+
+#if defined(__APPLE__)
+    const int64_t modifiedTime = static_cast<int64_t>(fileStat.st_mtimespec.tv_sec) * 1000000000 + fileStat.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    const int64_t modifiedTime = static_cast<int64_t>(fileStat.st_mtim.tv_sec) * 1000000000 + fileStat.st_mtim.tv_nsec;
+#else
+    const int64_t modifiedTime = static_cast<int64_t>(fileStat.st_mtime);
+#endif
+
+    return { static_cast<uint64_t>(fileStat.st_size), modifiedTime };
+}
+#endif
+
+// Returns the file's cached data, if any, and makes it the 'most recently used' entry. Must be called with m_mutex held.
+std::shared_ptr<const std::vector<uint8_t>> SharedResourceCache::Find(const std::string& path, const FileIdentity& identity)
+{
+    auto file = m_cache.Find(path);
+
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    // The file has changed since it was cached so discard the stale entry
+    if (file->identity != identity)
+    {
+        m_cache.Erase(path);
+        return nullptr;
+    }
+
+    return file->data;
+}
+
+SharedResourceStreamReader::SharedResourceStreamReader(std::string baseDirectory, std::shared_ptr<SharedResourceCache> cache) :
+    m_baseDirectory(std::move(baseDirectory)),
+    m_cache(std::move(cache))
+{
+    if (!m_cache)
+    {
+        throw GLTFException("SharedResourceStreamReader requires a cache");
+    }
+}
+
+std::shared_ptr<std::istream> SharedResourceStreamReader::GetInputStream(const std::string& uri) const
+{
+    return std::make_shared<MemoryStream>(m_cache->Get(m_baseDirectory.empty() ? uri : m_baseDirectory + "/" + uri));
+}
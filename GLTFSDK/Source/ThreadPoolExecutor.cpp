@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ThreadPoolExecutor.h>
+
+#include <algorithm>
+
+using namespace Microsoft::glTF;
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t threadCount) : m_isStopping(false)
+{
+    if (threadCount == 0U)
+    {
+        threadCount = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    m_threads.reserve(threadCount);
+
+    for (size_t i = 0U; i < threadCount; ++i)
+    {
+        m_threads.emplace_back(&ThreadPoolExecutor::Run, this);
+    }
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_condition.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPoolExecutor::Execute(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+
+    m_condition.notify_one();
+}
+
+size_t ThreadPoolExecutor::GetConcurrency() const
+{
+    return m_threads.size();
+}
+
+void ThreadPoolExecutor::Run()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_condition.wait(lock, [this]() { return m_isStopping || !m_tasks.empty(); });
+
+            // Only stop once every issued task has been run
+            if (m_tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}